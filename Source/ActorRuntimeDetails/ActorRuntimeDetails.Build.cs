@@ -48,6 +48,7 @@ public class ActorRuntimeDetails : ModuleRules
 				"Kismet",
 				"BlueprintGraph",
 				"GraphEditor",
+				"PropertyEditor",
 #if UE_4_24_OR_LATER
                 "ToolMenus",
 #else
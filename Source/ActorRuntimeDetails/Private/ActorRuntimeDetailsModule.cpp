@@ -13,7 +13,11 @@
 #include "IDocumentation.h"
 #include "TutorialMetaData.h"
 #include "SActorRuntimeDetails.h"
+#include "RuntimeActorSnapshot.h"
 #include "Engine/Selection.h"
+#include "PropertyEditorModule.h"
+#include "ProfilingDebugging/ScopedTimers.h"
+#include "ActorRuntimeDetailsStats.h"
 
 #if UE_4_24_OR_LATER
 #include "Widgets/SWidget.h"
@@ -24,28 +28,32 @@
 
 static const FName ActorRuntimeDetailsTabName("ActorRuntimeDetails");
 
+/** Like the level editor's details tabs, up to four Runtime Details tabs can be opened, each lockable on its own */
+static const FName RuntimeDetailsTabIdentifiers[] =
+{
+	"LevelEditorRuntimeSelectionDetails",
+	"LevelEditorRuntimeSelectionDetails2",
+	"LevelEditorRuntimeSelectionDetails3",
+	"LevelEditorRuntimeSelectionDetails4",
+};
+
+DECLARE_CYCLE_STAT(TEXT("Module StartupModule"), STAT_ActorRuntimeDetails_StartupModule, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Module InitializeOnFirstUse"), STAT_ActorRuntimeDetails_InitializeOnFirstUse, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Module OnActorSelectionChanged"), STAT_ActorRuntimeDetails_OnActorSelectionChanged, STATGROUP_ActorRuntimeDetails);
+
 #define LOCTEXT_NAMESPACE "FActorRuntimeDetailsModule"
 
 void FActorRuntimeDetailsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
-	
-	FActorRuntimeDetailsStyle::Initialize();
-	FActorRuntimeDetailsStyle::ReloadTextures();
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_StartupModule);
+	SCOPE_LOG_TIME_IN_SECONDS(TEXT("FActorRuntimeDetailsModule::StartupModule"), nullptr);
 
-	FActorRuntimeDetailsCommands::Register();
-	
-	PluginCommands = MakeShareable(new FUICommandList);
+	bInitializedOnFirstUse = false;
 
-	PluginCommands->MapAction(
-		FActorRuntimeDetailsCommands::Get().PluginAction,
-		FExecuteAction::CreateRaw(this, &FActorRuntimeDetailsModule::PluginButtonClicked),
-		FCanExecuteAction());
-		
+	// Only the tab spawners are registered here; everything else waits for the first Runtime Details tab, see InitializeOnFirstUse()
 	FLevelEditorModule& LevelEditorModule = FModuleManager::LoadModuleChecked<FLevelEditorModule>("LevelEditor");
 
-	const IWorkspaceMenuStructure& MenuStructure = WorkspaceMenu::GetMenuStructure();
-
 	TSharedPtr<FTabManager> LevelEditorTabManager = LevelEditorModule.GetLevelEditorTabManager();
 	
 	if (LevelEditorTabManager)
@@ -68,9 +76,45 @@ void FActorRuntimeDetailsModule::ShutdownModule()
 		LevelEditorModule.OnTabManagerChanged().Remove(LevelEditorTabManagerChangedHandle);
 	}
 
-	FActorRuntimeDetailsStyle::Shutdown();
+	if (bInitializedOnFirstUse)
+	{
+		FRuntimeActorSnapshot::FlushSnapshotProperties();
+
+		FActorRuntimeDetailsStyle::Shutdown();
+
+		FActorRuntimeDetailsCommands::Unregister();
+
+		bInitializedOnFirstUse = false;
+	}
+}
+
+void FActorRuntimeDetailsModule::InitializeOnFirstUse()
+{
+	if (bInitializedOnFirstUse)
+	{
+		return;
+	}
+
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_InitializeOnFirstUse);
+	SCOPE_LOG_TIME_IN_SECONDS(TEXT("FActorRuntimeDetailsModule::InitializeOnFirstUse"), nullptr);
+
+	bInitializedOnFirstUse = true;
+
+	// The style's brushes are loaded by the Slate renderer when first drawn, so there is no need to reload its textures
+	FActorRuntimeDetailsStyle::Initialize();
+
+	FActorRuntimeDetailsCommands::Register();
+	
+	PluginCommands = MakeShareable(new FUICommandList);
 
-	FActorRuntimeDetailsCommands::Unregister();
+	PluginCommands->MapAction(
+		FActorRuntimeDetailsCommands::Get().PluginAction,
+		FExecuteAction::CreateRaw(this, &FActorRuntimeDetailsModule::PluginButtonClicked),
+		FCanExecuteAction());
+
+	// Modules the panels depend on, loaded here rather than by whichever widget happens to need them first
+	FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
+	FModuleManager::LoadModuleChecked<IModuleInterface>("Kismet");
 }
 
 void FActorRuntimeDetailsModule::RegisterTabSpawner()
@@ -86,11 +130,17 @@ void FActorRuntimeDetailsModule::RegisterTabSpawner()
 		const FText DetailsTooltip = NSLOCTEXT("LevelEditorTabs", "LevelEditorSelectionDetailsTooltip", "Open a Runtime Details tab. Use this to view and edit properties of the selected object(s).");
 		const FSlateIcon DetailsIcon(FEditorStyle::GetStyleSetName(), "LevelEditor.Tabs.Details");
 
-		LevelEditorTabManager->RegisterTabSpawner("LevelEditorRuntimeSelectionDetails", FOnSpawnTab::CreateRaw(this, &FActorRuntimeDetailsModule::SpawnActorRuntimeDetailsTab))
-			.SetDisplayName(NSLOCTEXT("LevelEditorTabs", "LevelEditorRuntimeSelectionDetails", "Runtime Details 1"))
-			.SetTooltipText(DetailsTooltip)
-			.SetGroup(MenuStructure.GetLevelEditorDetailsCategory())
-			.SetIcon(DetailsIcon);
+		int32 TabNumber = 1;
+		for (const FName& TabIdentifier : RuntimeDetailsTabIdentifiers)
+		{
+			const FText Label = FText::Format(NSLOCTEXT("LevelEditorTabs", "LevelEditorRuntimeSelectionDetailsN", "Runtime Details {0}"), FText::AsNumber(TabNumber++));
+
+			LevelEditorTabManager->RegisterTabSpawner(TabIdentifier, FOnSpawnTab::CreateRaw(this, &FActorRuntimeDetailsModule::SpawnActorRuntimeDetailsTab, TabIdentifier, Label))
+				.SetDisplayName(Label)
+				.SetTooltipText(DetailsTooltip)
+				.SetGroup(MenuStructure.GetLevelEditorDetailsCategory())
+				.SetIcon(DetailsIcon);
+		}
 	}
 }
 
@@ -133,11 +183,11 @@ TSharedRef<SWidget> FActorRuntimeDetailsModule::CreateActorRuntimeDetails(const
 	return ActorRuntimeDetails;
 }
 
-TSharedRef<SDockTab> FActorRuntimeDetailsModule::SpawnActorRuntimeDetailsTab(const FSpawnTabArgs& Args)
+TSharedRef<SDockTab> FActorRuntimeDetailsModule::SpawnActorRuntimeDetailsTab(const FSpawnTabArgs& Args, FName TabIdentifier, FText Label)
 {
-	TSharedRef<SActorRuntimeDetails> ActorRuntimeDetails = StaticCastSharedRef<SActorRuntimeDetails>(CreateActorRuntimeDetails("LevelEditorRuntimeSelectionDetails"));
+	InitializeOnFirstUse();
 
-	const FText Label = NSLOCTEXT("LevelEditor", "RuntimeDetailsTabTitle", "Runtime Details 1");
+	TSharedRef<SActorRuntimeDetails> ActorRuntimeDetails = StaticCastSharedRef<SActorRuntimeDetails>(CreateActorRuntimeDetails(TabIdentifier));
 
 	TSharedRef<SDockTab> DocTab = SNew(SDockTab)
 		.Icon(FEditorStyle::GetBrush("LevelEditor.Tabs.Details"))
@@ -156,16 +206,23 @@ TSharedRef<SDockTab> FActorRuntimeDetailsModule::SpawnActorRuntimeDetailsTab(con
 
 void FActorRuntimeDetailsModule::OnActorSelectionChanged(const TArray<UObject*>& NewSelection, bool bForceRefresh)
 {
-	for (auto It = AllActorDetailPanels.CreateIterator(); It; ++It)
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_OnActorSelectionChanged);
+
+	// Panels whose tab was closed are dropped here, as nothing else removes them from the list
+	AllActorDetailPanels.RemoveAllSwap([](const TWeakPtr<SActorRuntimeDetails>& Panel) { return !Panel.IsValid(); });
+	if (AllActorDetailPanels.Num() == 0 || GEditor->PlayWorld == nullptr)
 	{
-		TSharedPtr<SActorRuntimeDetails> ActorRuntimeDetails = It->Pin();
+		return;
+	}
+
+	// Every panel shares the same snapshot of the selection; the ones in background tabs only refresh once brought to the foreground
+	TSharedRef<const FActorRuntimeDetailsSelection> Selection = SActorRuntimeDetails::MakeSelection(NewSelection);
+	for (const TWeakPtr<SActorRuntimeDetails>& Panel : AllActorDetailPanels)
+	{
+		TSharedPtr<SActorRuntimeDetails> ActorRuntimeDetails = Panel.Pin();
 		if (ActorRuntimeDetails.IsValid())
 		{
-			ActorRuntimeDetails->SetObjects(NewSelection, bForceRefresh);
-		}
-		else
-		{
-			// remove stray entries here
+			ActorRuntimeDetails->SetSelection(Selection, bForceRefresh);
 		}
 	}
 }
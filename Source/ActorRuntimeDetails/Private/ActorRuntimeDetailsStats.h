@@ -0,0 +1,26 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ARDUEFeatures.h"
+
+#if UE_4_25_OR_LATER
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#endif
+
+DECLARE_STATS_GROUP(TEXT("ActorRuntimeDetails"), STATGROUP_ActorRuntimeDetails, STATCAT_Advanced);
+
+/**
+ * Scopes a cycle stat and, on engines that have Insights, a CPU trace event of the same name. It declares scoped locals, so use it
+ * at the top of a braced block like SCOPE_CYCLE_COUNTER, never as the body of an unbraced if or loop.
+ */
+#if UE_4_25_OR_LATER
+#define ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat); \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Stat)
+#else
+#define ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(Stat) \
+	SCOPE_CYCLE_COUNTER(Stat)
+#endif
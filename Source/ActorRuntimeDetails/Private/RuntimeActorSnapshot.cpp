@@ -0,0 +1,292 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "RuntimeActorSnapshot.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "UObject/UnrealType.h"
+#include "ScopedTransaction.h"
+#include "Editor.h"
+#include "ActorRuntimeDetailsStats.h"
+
+#define LOCTEXT_NAMESPACE "RuntimeActorSnapshot"
+
+DECLARE_CYCLE_STAT(TEXT("Snapshot Capture"), STAT_ActorRuntimeDetails_SnapshotCapture, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Snapshot Restore"), STAT_ActorRuntimeDetails_SnapshotRestore, STATGROUP_ActorRuntimeDetails);
+
+FRuntimeActorSnapshot::FRuntimeActorSnapshot()
+{
+}
+
+FRuntimeActorSnapshot::~FRuntimeActorSnapshot()
+{
+	Reset();
+}
+
+bool FRuntimeActorSnapshot::IsSnapshotProperty(UProperty* Property)
+{
+	// Only what can be edited on an instance from the details view
+	if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_EditConst | CPF_DisableEditOnInstance | CPF_Deprecated))
+	{
+		return false;
+	}
+
+	TArray<const UStructProperty*> EncounteredStructProps;
+	return !Property->ContainsObjectReference(EncounteredStructProps);
+}
+
+/**
+ * The snapshot properties of each class a snapshot was captured from or restored to. A Blueprint recompiled in place keeps its
+ * class but replaces its properties, so the whole cache is flushed whenever a Blueprint is compiled or objects are reinstanced.
+ */
+static TMap<TWeakObjectPtr<UClass>, TArray<UProperty*>> SnapshotPropertiesByClass;
+static FDelegateHandle BlueprintCompiledHandle;
+static FDelegateHandle ObjectsReplacedHandle;
+
+void FRuntimeActorSnapshot::FlushSnapshotProperties()
+{
+	SnapshotPropertiesByClass.Empty();
+
+	// The delegates are added again when the cache is refilled
+	if (BlueprintCompiledHandle.IsValid())
+	{
+		if (GEditor)
+		{
+			GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+		}
+		BlueprintCompiledHandle.Reset();
+	}
+	if (ObjectsReplacedHandle.IsValid())
+	{
+		FCoreUObjectDelegates::OnObjectsReplaced.Remove(ObjectsReplacedHandle);
+		ObjectsReplacedHandle.Reset();
+	}
+}
+
+const TArray<UProperty*>& FRuntimeActorSnapshot::GetSnapshotProperties(UClass* Class)
+{
+	if (const TArray<UProperty*>* SnapshotProperties = SnapshotPropertiesByClass.Find(Class))
+	{
+		return *SnapshotProperties;
+	}
+
+	if (!ObjectsReplacedHandle.IsValid())
+	{
+		if (GEditor)
+		{
+			BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddStatic(&FRuntimeActorSnapshot::FlushSnapshotProperties);
+		}
+		ObjectsReplacedHandle = FCoreUObjectDelegates::OnObjectsReplaced.AddLambda([](const TMap<UObject*, UObject*>&) { FlushSnapshotProperties(); });
+	}
+
+	// Classes that were garbage collected since can't be looked up any more
+	for (auto It = SnapshotPropertiesByClass.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	TArray<UProperty*>& SnapshotProperties = SnapshotPropertiesByClass.Add(Class);
+	for (TFieldIterator<UProperty> It(Class); It; ++It)
+	{
+		if (IsSnapshotProperty(*It))
+		{
+			SnapshotProperties.Add(*It);
+		}
+	}
+	SnapshotProperties.Shrink();
+
+	return SnapshotProperties;
+}
+
+bool FRuntimeActorSnapshot::IsClassCurrent(const FSnapshotObject& SnapshotObject)
+{
+	const UClass* Class = SnapshotObject.Class.Get();
+	return Class != nullptr && !Class->HasAnyClassFlags(CLASS_NewerVersionExists);
+}
+
+bool FRuntimeActorSnapshot::IsIdenticalValue(UProperty* Property, const void* ValueA, const void* ValueB)
+{
+	for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
+	{
+		const int32 ElementOffset = ArrayIndex * Property->ElementSize;
+		if (!Property->Identical((const uint8*)ValueA + ElementOffset, (const uint8*)ValueB + ElementOffset, PPF_None))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void FRuntimeActorSnapshot::Capture(AActor* InActor)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_SnapshotCapture);
+
+	Reset();
+
+	if (InActor == nullptr)
+	{
+		return;
+	}
+
+	Actor = InActor;
+
+	TArray<UObject*, TInlineAllocator<32>> ObjectsToCapture;
+	ObjectsToCapture.Add(InActor);
+	for (UActorComponent* Component : InActor->GetComponents())
+	{
+		if (Component != nullptr && !Component->IsPendingKill())
+		{
+			ObjectsToCapture.Add(Component);
+		}
+	}
+
+	// Find the properties that differ from the archetype and lay out their values, so that the buffer is allocated only once
+	int32 BufferSize = 0;
+	Objects.Reserve(ObjectsToCapture.Num());
+	for (UObject* Object : ObjectsToCapture)
+	{
+		FSnapshotObject& SnapshotObject = Objects[Objects.AddUninitialized()];
+		SnapshotObject.Object = Object;
+		SnapshotObject.Class = Object->GetClass();
+		SnapshotObject.FirstProperty = Properties.Num();
+
+		const UObject* Archetype = Object->GetArchetype();
+		for (UProperty* Property : GetSnapshotProperties(Object->GetClass()))
+		{
+			// A property the archetype doesn't have always counts as changed
+			if (Archetype != nullptr && Archetype->IsA(Property->GetOwnerClass())
+				&& IsIdenticalValue(Property, Property->ContainerPtrToValuePtr<void>(Object), Property->ContainerPtrToValuePtr<void>(Archetype)))
+			{
+				continue;
+			}
+
+			BufferSize = Align(BufferSize, Property->GetMinAlignment());
+			Properties.Add(FSnapshotProperty{ Property, BufferSize });
+			BufferSize += Property->ElementSize * Property->ArrayDim;
+		}
+
+		SnapshotObject.NumProperties = Properties.Num() - SnapshotObject.FirstProperty;
+	}
+
+	Buffer.SetNumUninitialized(BufferSize);
+	for (const FSnapshotObject& SnapshotObject : Objects)
+	{
+		const UObject* Object = SnapshotObject.Object.Get();
+		for (int32 PropertyIndex = SnapshotObject.FirstProperty; PropertyIndex < SnapshotObject.FirstProperty + SnapshotObject.NumProperties; ++PropertyIndex)
+		{
+			const FSnapshotProperty& SnapshotProperty = Properties[PropertyIndex];
+			void* Value = Buffer.GetData() + SnapshotProperty.Offset;
+			SnapshotProperty.Property->InitializeValue(Value);
+			SnapshotProperty.Property->CopyCompleteValue(Value, SnapshotProperty.Property->ContainerPtrToValuePtr<void>(Object));
+		}
+	}
+}
+
+int32 FRuntimeActorSnapshot::Restore() const
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_SnapshotRestore);
+
+	AActor* ActorInstance = Actor.Get();
+	if (ActorInstance == nullptr)
+	{
+		return 0;
+	}
+
+	const FScopedTransaction Transaction(LOCTEXT("RestoreSnapshot", "Restore Runtime Snapshot"));
+
+	// As for edits made in the details view, the notifications below must not reconstruct the Actor
+	const bool bWasSeamlessTraveled = ActorInstance->bActorSeamlessTraveled;
+	ActorInstance->bActorSeamlessTraveled = true;
+
+	int32 NumRestoredProperties = 0;
+	for (const FSnapshotObject& SnapshotObject : Objects)
+	{
+		UObject* Object = SnapshotObject.Object.Get();
+		if (Object == nullptr || Object->IsPendingKill() || !IsClassCurrent(SnapshotObject) || Object->GetClass() != SnapshotObject.Class.Get())
+		{
+			continue;
+		}
+
+		// Captured properties are restored, and the other snapshot properties go back to the archetype, in case they were edited
+		// since; the captured ones are a subset of the snapshot properties, and both are in field order
+		const UObject* Archetype = Object->GetArchetype();
+		int32 PropertyIndex = SnapshotObject.FirstProperty;
+		const int32 EndPropertyIndex = SnapshotObject.FirstProperty + SnapshotObject.NumProperties;
+		bool bModified = false;
+
+		for (UProperty* Property : GetSnapshotProperties(Object->GetClass()))
+		{
+			const void* SourceValue = nullptr;
+			if (PropertyIndex < EndPropertyIndex && Properties[PropertyIndex].Property == Property)
+			{
+				SourceValue = Buffer.GetData() + Properties[PropertyIndex].Offset;
+				++PropertyIndex;
+			}
+			else if (Archetype != nullptr && Archetype->IsA(Property->GetOwnerClass()))
+			{
+				SourceValue = Property->ContainerPtrToValuePtr<void>(Archetype);
+			}
+			else
+			{
+				continue;
+			}
+
+			void* Value = Property->ContainerPtrToValuePtr<void>(Object);
+			if (IsIdenticalValue(Property, Value, SourceValue))
+			{
+				continue;
+			}
+
+			if (!bModified)
+			{
+				Object->Modify();
+				Object->PreEditChange(nullptr);
+				bModified = true;
+			}
+
+			Property->CopyCompleteValue(Value, SourceValue);
+			++NumRestoredProperties;
+		}
+
+		if (bModified)
+		{
+			Object->PostEditChange();
+		}
+	}
+
+	ActorInstance->bActorSeamlessTraveled = bWasSeamlessTraveled;
+
+	return NumRestoredProperties;
+}
+
+void FRuntimeActorSnapshot::Reset()
+{
+	for (const FSnapshotObject& SnapshotObject : Objects)
+	{
+		// Leaking what a stale value owns is preferable to destroying it through a property that may be gone
+		if (!IsClassCurrent(SnapshotObject))
+		{
+			continue;
+		}
+
+		for (int32 PropertyIndex = SnapshotObject.FirstProperty; PropertyIndex < SnapshotObject.FirstProperty + SnapshotObject.NumProperties; ++PropertyIndex)
+		{
+			const FSnapshotProperty& SnapshotProperty = Properties[PropertyIndex];
+			SnapshotProperty.Property->DestroyValue(Buffer.GetData() + SnapshotProperty.Offset);
+		}
+	}
+
+	Actor.Reset();
+	Objects.Reset();
+	Properties.Reset();
+	Buffer.Reset();
+}
+
+SIZE_T FRuntimeActorSnapshot::GetAllocatedSize() const
+{
+	return Objects.GetAllocatedSize() + Properties.GetAllocatedSize() + Buffer.GetAllocatedSize();
+}
+
+#undef LOCTEXT_NAMESPACE
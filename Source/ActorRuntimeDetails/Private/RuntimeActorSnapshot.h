@@ -0,0 +1,91 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtr.h"
+
+class AActor;
+class UClass;
+class UProperty;
+
+/**
+ * The edited state of an Actor instance and its components, captured as a delta against their archetypes. Only the editable
+ * properties whose value differs from the archetype are copied, each into its own range of a single buffer, so the memory
+ * scales with what was changed rather than with the size of the objects. Capturing and restoring only visit the properties that
+ * snapshots can capture, listed once per class.
+ */
+class FRuntimeActorSnapshot
+{
+public:
+	FRuntimeActorSnapshot();
+	~FRuntimeActorSnapshot();
+
+	/** Captures the current state of the given Actor and its components, replacing any previous capture */
+	void Capture(AActor* InActor);
+
+	/**
+	 * Writes the captured state back to the Actor and its components in one batch, within a single transaction. Properties
+	 * that matched the archetype when captured are reset to it. Each object that changes is modified and notified only once,
+	 * without reconstructing the Actor.
+	 *
+	 * @return The number of properties whose value was changed
+	 */
+	int32 Restore() const;
+
+	/**
+	 * Releases the captured values. The values of an object whose class was garbage collected or replaced by a newer class since
+	 * the capture are dropped without being destroyed, as the properties that describe them may no longer exist. A Blueprint
+	 * recompiled in place keeps its class and can't be detected here, so the snapshot must be reset when a Blueprint is compiled.
+	 */
+	void Reset();
+
+	/** @return The Actor the snapshot was captured from, if it still exists */
+	AActor* GetActor() const { return Actor.Get(); }
+
+	/** @return The number of captured properties */
+	int32 GetNumProperties() const { return Properties.Num(); }
+
+	/** @return The memory used by the captured values and their bookkeeping */
+	SIZE_T GetAllocatedSize() const;
+
+	/** @return True if the given property is captured by snapshots: editable on instances, and without object references, which the snapshot doesn't keep alive */
+	static bool IsSnapshotProperty(UProperty* Property);
+
+	/** @return The properties of the given class that are captured by snapshots, in field order; the list is built once per class */
+	static const TArray<UProperty*>& GetSnapshotProperties(UClass* Class);
+
+	/** Forgets the snapshot properties listed for every class, which are listed again on their next use */
+	static void FlushSnapshotProperties();
+
+private:
+	/** A captured property and the range of the buffer holding its value */
+	struct FSnapshotProperty
+	{
+		UProperty* Property;
+		int32 Offset;
+	};
+
+	/** A captured object, the class its properties were captured through, and the range of Properties captured from it, in field order */
+	struct FSnapshotObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		TWeakObjectPtr<UClass> Class;
+		int32 FirstProperty;
+		int32 NumProperties;
+	};
+
+	/** @return True if the class the object was captured through still exists and wasn't replaced by a newer class, as reinstancing does */
+	static bool IsClassCurrent(const FSnapshotObject& SnapshotObject);
+
+	/** @return True if every element of the two values of the property is identical */
+	static bool IsIdenticalValue(UProperty* Property, const void* ValueA, const void* ValueB);
+
+	TWeakObjectPtr<AActor> Actor;
+	TArray<FSnapshotObject> Objects;
+	TArray<FSnapshotProperty> Properties;
+	TArray<uint8> Buffer;
+
+	FRuntimeActorSnapshot(const FRuntimeActorSnapshot&) = delete;
+	FRuntimeActorSnapshot& operator=(const FRuntimeActorSnapshot&) = delete;
+};
@@ -0,0 +1,252 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "RuntimeComponentTransformDetails.h"
+#include "Components/SceneComponent.h"
+#include "DetailLayoutBuilder.h"
+#include "DetailCategoryBuilder.h"
+#include "DetailWidgetRow.h"
+#include "Editor.h"
+#include "ScopedTransaction.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SVectorInputBox.h"
+#include "Widgets/Input/SRotatorInputBox.h"
+#include "RuntimeDetailsEditorUtils.h"
+#include "ActorRuntimeDetailsStats.h"
+
+#define LOCTEXT_NAMESPACE "RuntimeComponentTransformDetails"
+
+DECLARE_CYCLE_STAT(TEXT("Transform Fast Path"), STAT_ActorRuntimeDetails_TransformFastPath, STATGROUP_ActorRuntimeDetails);
+
+static const FName RelativeLocationName(TEXT("RelativeLocation"));
+static const FName RelativeRotationName(TEXT("RelativeRotation"));
+static const FName RelativeScale3DName(TEXT("RelativeScale3D"));
+
+TSharedRef<IDetailCustomization> FRuntimeComponentTransformDetails::MakeInstance()
+{
+	return MakeShareable(new FRuntimeComponentTransformDetails);
+}
+
+FRuntimeComponentTransformDetails::FRuntimeComponentTransformDetails()
+	: bIsSliderTransactionOpen(false)
+{
+}
+
+void FRuntimeComponentTransformDetails::CustomizeDetails(IDetailLayoutBuilder& DetailBuilder)
+{
+	TArray<TWeakObjectPtr<UObject>> Objects;
+	DetailBuilder.GetObjectsBeingCustomized(Objects);
+	for (const TWeakObjectPtr<UObject>& Object : Objects)
+	{
+		if (USceneComponent* SceneComponent = Cast<USceneComponent>(Object.Get()))
+		{
+			SelectedComponents.Add(SceneComponent);
+		}
+	}
+
+	if (SelectedComponents.Num() == 0)
+	{
+		return;
+	}
+
+	// The relative transform is edited through the rows below instead
+	DetailBuilder.HideProperty(DetailBuilder.GetProperty(RelativeLocationName, USceneComponent::StaticClass()));
+	DetailBuilder.HideProperty(DetailBuilder.GetProperty(RelativeRotationName, USceneComponent::StaticClass()));
+	DetailBuilder.HideProperty(DetailBuilder.GetProperty(RelativeScale3DName, USceneComponent::StaticClass()));
+
+	IDetailCategoryBuilder& TransformCategory = DetailBuilder.EditCategory("TransformCommon", LOCTEXT("TransformCommonCategory", "Transform"), ECategoryPriority::Transform);
+	AddVectorRow(TransformCategory, LOCTEXT("LocationLabel", "Location"), ETransformField::Location);
+	AddRotationRow(TransformCategory, LOCTEXT("RotationLabel", "Rotation"));
+	AddVectorRow(TransformCategory, LOCTEXT("ScaleLabel", "Scale"), ETransformField::Scale);
+}
+
+void FRuntimeComponentTransformDetails::AddVectorRow(IDetailCategoryBuilder& Category, const FText& Label, ETransformField Field)
+{
+	Category.AddCustomRow(Label)
+	.NameContent()
+	[
+		SNew(STextBlock)
+		.Text(Label)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+	]
+	.ValueContent()
+	.MinDesiredWidth(125.0f * 3.0f)
+	.MaxDesiredWidth(125.0f * 3.0f)
+	[
+		SNew(SVectorInputBox)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+		.bColorAxisLabels(true)
+		.AllowSpin(true)
+		.X(this, &FRuntimeComponentTransformDetails::GetValue, Field, 0)
+		.Y(this, &FRuntimeComponentTransformDetails::GetValue, Field, 1)
+		.Z(this, &FRuntimeComponentTransformDetails::GetValue, Field, 2)
+		.OnXChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, Field, 0)
+		.OnYChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, Field, 1)
+		.OnZChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, Field, 2)
+		.OnXCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, Field, 0)
+		.OnYCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, Field, 1)
+		.OnZCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, Field, 2)
+		.OnBeginSliderMovement(this, &FRuntimeComponentTransformDetails::OnBeginSliderMovement)
+		.OnEndSliderMovement(this, &FRuntimeComponentTransformDetails::OnEndSliderMovement)
+	];
+}
+
+void FRuntimeComponentTransformDetails::AddRotationRow(IDetailCategoryBuilder& Category, const FText& Label)
+{
+	// Axes are numbered Roll, Pitch, Yaw, the order they are shown in
+	Category.AddCustomRow(Label)
+	.NameContent()
+	[
+		SNew(STextBlock)
+		.Text(Label)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+	]
+	.ValueContent()
+	.MinDesiredWidth(125.0f * 3.0f)
+	.MaxDesiredWidth(125.0f * 3.0f)
+	[
+		SNew(SRotatorInputBox)
+		.Font(IDetailLayoutBuilder::GetDetailFont())
+		.bColorAxisLabels(true)
+		.AllowSpin(true)
+		.Roll(this, &FRuntimeComponentTransformDetails::GetValue, ETransformField::Rotation, 0)
+		.Pitch(this, &FRuntimeComponentTransformDetails::GetValue, ETransformField::Rotation, 1)
+		.Yaw(this, &FRuntimeComponentTransformDetails::GetValue, ETransformField::Rotation, 2)
+		.OnRollChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, ETransformField::Rotation, 0)
+		.OnPitchChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, ETransformField::Rotation, 1)
+		.OnYawChanged(this, &FRuntimeComponentTransformDetails::OnValueChanged, ETransformField::Rotation, 2)
+		.OnRollCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, ETransformField::Rotation, 0)
+		.OnPitchCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, ETransformField::Rotation, 1)
+		.OnYawCommitted(this, &FRuntimeComponentTransformDetails::OnValueCommitted, ETransformField::Rotation, 2)
+		.OnBeginSliderMovement(this, &FRuntimeComponentTransformDetails::OnBeginSliderMovement)
+		.OnEndSliderMovement(this, &FRuntimeComponentTransformDetails::OnEndSliderMovement)
+	];
+}
+
+float FRuntimeComponentTransformDetails::GetTransformAxis(USceneComponent* SceneComponent, ETransformField Field, int32 Axis)
+{
+	switch (Field)
+	{
+	case ETransformField::Location:
+		return FRuntimeDetailsEditorUtils::GetRelativeLocation(SceneComponent)[Axis];
+	case ETransformField::Rotation:
+	{
+		const FRotator Rotation = FRuntimeDetailsEditorUtils::GetRelativeRotation(SceneComponent);
+		return Axis == 0 ? Rotation.Roll : (Axis == 1 ? Rotation.Pitch : Rotation.Yaw);
+	}
+	default:
+		return FRuntimeDetailsEditorUtils::GetRelativeScale3D(SceneComponent)[Axis];
+	}
+}
+
+TOptional<float> FRuntimeComponentTransformDetails::GetValue(ETransformField Field, int32 Axis) const
+{
+	TOptional<float> Value;
+	for (const TWeakObjectPtr<USceneComponent>& SceneComponent : SelectedComponents)
+	{
+		if (SceneComponent.IsValid())
+		{
+			const float ComponentValue = GetTransformAxis(SceneComponent.Get(), Field, Axis);
+			if (!Value.IsSet())
+			{
+				Value = ComponentValue;
+			}
+			else if (Value.GetValue() != ComponentValue)
+			{
+				// Multiple values
+				return TOptional<float>();
+			}
+		}
+	}
+	return Value;
+}
+
+void FRuntimeComponentTransformDetails::OnValueChanged(float NewValue, ETransformField Field, int32 Axis)
+{
+	// Only slider drags are applied as they go; typed values are applied once committed
+	if (bIsSliderTransactionOpen)
+	{
+		SetValue(NewValue, Field, Axis);
+	}
+}
+
+void FRuntimeComponentTransformDetails::OnValueCommitted(float NewValue, ETextCommit::Type CommitType, ETransformField Field, int32 Axis)
+{
+	if (bIsSliderTransactionOpen)
+	{
+		SetValue(NewValue, Field, Axis);
+	}
+	else if (GetValue(Field, Axis) != TOptional<float>(NewValue))
+	{
+		// The end of a drag commits the value it already applied, which is skipped here rather than recorded again
+		const FScopedTransaction Transaction(LOCTEXT("EditTransform", "Edit Transform"));
+		ModifyComponents();
+		SetValue(NewValue, Field, Axis);
+	}
+}
+
+void FRuntimeComponentTransformDetails::OnBeginSliderMovement()
+{
+	if (!bIsSliderTransactionOpen)
+	{
+		GEditor->BeginTransaction(LOCTEXT("EditTransform", "Edit Transform"));
+		ModifyComponents();
+		bIsSliderTransactionOpen = true;
+	}
+}
+
+void FRuntimeComponentTransformDetails::OnEndSliderMovement(float NewValue)
+{
+	if (bIsSliderTransactionOpen)
+	{
+		GEditor->EndTransaction();
+		bIsSliderTransactionOpen = false;
+	}
+}
+
+void FRuntimeComponentTransformDetails::SetValue(float NewValue, ETransformField Field, int32 Axis)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_TransformFastPath);
+
+	// The whole selection is moved as one batch, so that dragging a value on many components updates each of them only once
+	BatchComponents.Reset();
+	BatchTransforms.Reset();
+	for (const TWeakObjectPtr<USceneComponent>& SceneComponentPtr : SelectedComponents)
+	{
+		USceneComponent* SceneComponent = SceneComponentPtr.Get();
+		if (SceneComponent == nullptr)
+		{
+			continue;
+		}
+
+		FRuntimeRelativeTransform& RelativeTransform = BatchTransforms[BatchTransforms.Add(FRuntimeDetailsEditorUtils::GetRelativeTransform(SceneComponent))];
+		switch (Field)
+		{
+		case ETransformField::Location:
+			RelativeTransform.Location[Axis] = NewValue;
+			break;
+		case ETransformField::Rotation:
+			(Axis == 0 ? RelativeTransform.Rotation.Roll : (Axis == 1 ? RelativeTransform.Rotation.Pitch : RelativeTransform.Rotation.Yaw)) = NewValue;
+			break;
+		case ETransformField::Scale:
+			RelativeTransform.Scale3D[Axis] = NewValue;
+			break;
+		}
+
+		BatchComponents.Add(SceneComponent);
+	}
+
+	FRuntimeDetailsEditorUtils::SetRelativeTransforms(BatchComponents, BatchTransforms);
+}
+
+void FRuntimeComponentTransformDetails::ModifyComponents()
+{
+	for (const TWeakObjectPtr<USceneComponent>& SceneComponent : SelectedComponents)
+	{
+		if (SceneComponent.IsValid())
+		{
+			SceneComponent->Modify();
+		}
+	}
+}
+
+#undef LOCTEXT_NAMESPACE
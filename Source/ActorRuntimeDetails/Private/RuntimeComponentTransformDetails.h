@@ -0,0 +1,68 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/SlateDelegates.h"
+#include "IDetailCustomization.h"
+#include "RuntimeDetailsEditorUtils.h"
+
+class IDetailCategoryBuilder;
+class IDetailLayoutBuilder;
+class USceneComponent;
+
+/**
+ * Replaces the transform rows of scene components in the runtime details panel. Edited values are written straight to the
+ * selected components as one batch through FRuntimeDetailsEditorUtils::SetRelativeTransforms(), which only updates their
+ * world transforms and those of their children; the generic PreEditChange/PostEditChange pipeline, which reregisters the
+ * component on every change, is skipped.
+ */
+class FRuntimeComponentTransformDetails : public IDetailCustomization, public TSharedFromThis<FRuntimeComponentTransformDetails>
+{
+public:
+	static TSharedRef<IDetailCustomization> MakeInstance();
+
+	FRuntimeComponentTransformDetails();
+
+	/** IDetailCustomization interface */
+	virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override;
+
+private:
+	/** The part of the relative transform edited by a row */
+	enum class ETransformField : uint8
+	{
+		Location,
+		Rotation,
+		Scale,
+	};
+
+	void AddVectorRow(IDetailCategoryBuilder& Category, const FText& Label, ETransformField Field);
+	void AddRotationRow(IDetailCategoryBuilder& Category, const FText& Label);
+
+	/** @return One axis of the given field of a component's relative transform; rotation axes are numbered Roll, Pitch, Yaw */
+	static float GetTransformAxis(USceneComponent* SceneComponent, ETransformField Field, int32 Axis);
+
+	/** @return The value of one axis of the given field if it is the same on every selected component */
+	TOptional<float> GetValue(ETransformField Field, int32 Axis) const;
+
+	void OnValueChanged(float NewValue, ETransformField Field, int32 Axis);
+	void OnValueCommitted(float NewValue, ETextCommit::Type CommitType, ETransformField Field, int32 Axis);
+	void OnBeginSliderMovement();
+	void OnEndSliderMovement(float NewValue);
+
+	/** Writes one axis of the given field to every selected component */
+	void SetValue(float NewValue, ETransformField Field, int32 Axis);
+
+	/** Calls Modify() on the selected components so that the edit can be undone */
+	void ModifyComponents();
+
+private:
+	TArray<TWeakObjectPtr<USceneComponent>> SelectedComponents;
+
+	// True while a slider is dragged; the whole drag is recorded in a single transaction
+	bool bIsSliderTransactionOpen;
+
+	// Scratch arrays for SetValue(), kept so that a drag doesn't allocate on every change
+	TArray<USceneComponent*> BatchComponents;
+	TArray<FRuntimeRelativeTransform> BatchTransforms;
+};
@@ -4,71 +4,170 @@
 
 #define LOCTEXT_NAMESPACE "FRuntimeDetailsEditorUtilsEditorUtils"
 
-int32 FRuntimeDetailsEditorUtils::DeleteComponents(const TArray<UActorComponent*>& ComponentsToDelete, UActorComponent*& OutComponentToSelect)
+/**
+ * Finds the component to select once the given components are deleted: the closest surviving sibling preceding the deleted
+ * branch, else the closest surviving attach parent, else the root component (or nothing if the root is deleted as well)
+ */
+static UActorComponent* FindComponentToSelectAfterDelete(UActorComponent* ComponentToDelete, const TSet<UActorComponent*>& ComponentsToDelete)
 {
-	int32 NumDeletedComponents = 0;
+	AActor* Owner = ComponentToDelete->GetOwner();
 
-	for (UActorComponent* ComponentToDelete : ComponentsToDelete)
+	USceneComponent* RootComponent = Owner->GetRootComponent();
+	if (ComponentsToDelete.Contains(RootComponent))
 	{
-		AActor* Owner = ComponentToDelete->GetOwner();
-		check(Owner != nullptr);
+		return nullptr;
+	}
 
-		// If necessary, determine the component that should be selected following the deletion of the indicated component
-		if (!OutComponentToSelect || ComponentToDelete == OutComponentToSelect)
+	// Worst-case, the root can be selected
+	UActorComponent* ComponentToSelect = RootComponent;
+
+	if (USceneComponent* ComponentToDeleteAsSceneComp = Cast<USceneComponent>(ComponentToDelete))
+	{
+		// Parents that are deleted too are skipped, along with the branch below them
+		USceneComponent* DeletedBranch = ComponentToDeleteAsSceneComp;
+		USceneComponent* ParentComponent = ComponentToDeleteAsSceneComp->GetAttachParent();
+		while (ParentComponent != nullptr && ComponentsToDelete.Contains(ParentComponent))
 		{
-			USceneComponent* RootComponent = Owner->GetRootComponent();
-			if (RootComponent != ComponentToDelete)
-			{
-				// Worst-case, the root can be selected
-				OutComponentToSelect = RootComponent;
+			DeletedBranch = ParentComponent;
+			ParentComponent = ParentComponent->GetAttachParent();
+		}
+
+		if (ParentComponent != nullptr)
+		{
+			// The deleted branch has a parent, so we select that in the absence of an appropriate sibling
+			ComponentToSelect = ParentComponent;
 
-				if (USceneComponent* ComponentToDeleteAsSceneComp = Cast<USceneComponent>(ComponentToDelete))
+			// Try to select the sibling that immediately precedes the deleted branch
+			for (USceneComponent* Sibling : ParentComponent->GetAttachChildren())
+			{
+				if (Sibling == DeletedBranch)
 				{
-					if (USceneComponent* ParentComponent = ComponentToDeleteAsSceneComp->GetAttachParent())
-					{
-						// The component to delete has a parent, so we select that in the absence of an appropriate sibling
-						OutComponentToSelect = ParentComponent;
-
-						// Try to select the sibling that immediately precedes the component to delete
-						TArray<USceneComponent*> Siblings;
-						ParentComponent->GetChildrenComponents(false, Siblings);
-						for (int32 i = 0; i < Siblings.Num() && ComponentToDelete != Siblings[i]; ++i)
-						{
-							if (Siblings[i] && !Siblings[i]->IsPendingKill())
-							{
-								OutComponentToSelect = Siblings[i];
-							}
-						}
-					}
+					break;
 				}
-				else
+				else if (Sibling != nullptr && !Sibling->IsPendingKill() && !ComponentsToDelete.Contains(Sibling))
 				{
-					// For a non-scene component, try to select the preceding non-scene component
-					for (UActorComponent* Component : Owner->GetComponents())
-					{
-						if (Component != nullptr)
-						{
-							if (Component == ComponentToDelete)
-							{
-								break;
-							}
-							else if (!Component->IsA<USceneComponent>())
-							{
-								OutComponentToSelect = Component;
-							}
-						}
-					}
+					ComponentToSelect = Sibling;
 				}
 			}
+		}
+	}
+	else
+	{
+		// For a non-scene component, try to select the preceding non-scene component
+		for (UActorComponent* Component : Owner->GetComponents())
+		{
+			if (Component != nullptr)
+			{
+				if (Component == ComponentToDelete)
+				{
+					break;
+				}
+				else if (!Component->IsA<USceneComponent>() && !ComponentsToDelete.Contains(Component))
+				{
+					ComponentToSelect = Component;
+				}
+			}
+		}
+	}
+
+	return ComponentToSelect;
+}
+
+int32 FRuntimeDetailsEditorUtils::DeleteComponents(const TArray<UActorComponent*>& ComponentsToDelete, UActorComponent*& OutComponentToSelect)
+{
+	if (ComponentsToDelete.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Every sibling, parent and child looked at below is tested against the components to delete
+	TSet<UActorComponent*> ComponentsToDeleteSet;
+	ComponentsToDeleteSet.Reserve(ComponentsToDelete.Num());
+	for (UActorComponent* ComponentToDelete : ComponentsToDelete)
+	{
+		check(ComponentToDelete->GetOwner() != nullptr);
+		ComponentsToDeleteSet.Add(ComponentToDelete);
+	}
+
+	// If necessary, determine the component that should be selected following the deletion, once for the whole batch
+	if (!OutComponentToSelect || ComponentsToDeleteSet.Contains(OutComponentToSelect))
+	{
+		OutComponentToSelect = FindComponentToSelectAfterDelete(ComponentsToDelete[0], ComponentsToDeleteSet);
+	}
+
+	// Surviving children of deleted components are attached straight to their closest surviving ancestor, rather than each
+	// DestroyComponent() promoting them one level at a time, possibly onto another component that is about to be deleted.
+	// Deleting the root is left to the engine, which also picks the new root component.
+	USceneComponent* RootComponentToDelete = nullptr;
+	TArray<USceneComponent*, TInlineAllocator<8>> ChildrenToPromote;
+	for (UActorComponent* ComponentToDelete : ComponentsToDelete)
+	{
+		USceneComponent* ComponentToDeleteAsSceneComp = Cast<USceneComponent>(ComponentToDelete);
+		if (ComponentToDeleteAsSceneComp == nullptr)
+		{
+			continue;
+		}
+
+		AActor* Owner = ComponentToDeleteAsSceneComp->GetOwner();
+		USceneComponent* RootComponent = Owner->GetRootComponent();
+		if (ComponentToDeleteAsSceneComp == RootComponent)
+		{
+			RootComponentToDelete = ComponentToDeleteAsSceneComp;
+			continue;
+		}
+
+		ChildrenToPromote.Reset();
+		for (USceneComponent* ChildComponent : ComponentToDeleteAsSceneComp->GetAttachChildren())
+		{
+			if (ChildComponent != nullptr && ChildComponent->GetOwner() == Owner && !ComponentsToDeleteSet.Contains(ChildComponent))
+			{
+				ChildrenToPromote.Add(ChildComponent);
+			}
+		}
+
+		if (ChildrenToPromote.Num() == 0)
+		{
+			continue;
+		}
+
+		USceneComponent* DeletedBranch = ComponentToDeleteAsSceneComp;
+		USceneComponent* NewParentComponent = ComponentToDeleteAsSceneComp->GetAttachParent();
+		while (NewParentComponent != nullptr && NewParentComponent != RootComponent && ComponentsToDeleteSet.Contains(NewParentComponent))
+		{
+			DeletedBranch = NewParentComponent;
+			NewParentComponent = NewParentComponent->GetAttachParent();
+		}
+
+		for (USceneComponent* ChildComponent : ChildrenToPromote)
+		{
+			ChildComponent->Modify();
+			if (NewParentComponent != nullptr)
+			{
+				ChildComponent->AttachToComponent(NewParentComponent, FAttachmentTransformRules::KeepWorldTransform, DeletedBranch->GetAttachSocketName());
+			}
 			else
 			{
-				OutComponentToSelect = nullptr;
+				ChildComponent->DetachFromComponent(FDetachmentTransformRules::KeepWorldTransform);
 			}
 		}
+	}
 
-		// Actually delete the component
-		ComponentToDelete->Modify();
-		ComponentToDelete->DestroyComponent(true);
+	// Actually delete the components, in a single pass
+	int32 NumDeletedComponents = 0;
+	for (UActorComponent* ComponentToDelete : ComponentsToDelete)
+	{
+		if (ComponentToDelete != RootComponentToDelete)
+		{
+			ComponentToDelete->Modify();
+			ComponentToDelete->DestroyComponent(/*bPromoteChildren =*/false);
+			NumDeletedComponents++;
+		}
+	}
+
+	if (RootComponentToDelete != nullptr)
+	{
+		RootComponentToDelete->Modify();
+		RootComponentToDelete->DestroyComponent(/*bPromoteChildren =*/true);
 		NumDeletedComponents++;
 	}
 
@@ -189,6 +288,81 @@ void FRuntimeDetailsEditorUtils::SetRelativeScale3D(USceneComponent* SceneCompon
 #endif
 }
 
+FRuntimeRelativeTransform FRuntimeDetailsEditorUtils::GetRelativeTransform(USceneComponent* SceneComponent)
+{
+	FRuntimeRelativeTransform RelativeTransform;
+	RelativeTransform.Location = GetRelativeLocation(SceneComponent);
+	RelativeTransform.Rotation = GetRelativeRotation(SceneComponent);
+	RelativeTransform.Scale3D = GetRelativeScale3D(SceneComponent);
+	return RelativeTransform;
+}
+
+void FRuntimeDetailsEditorUtils::SetRelativeTransforms(const TArray<USceneComponent*>& SceneComponents, const TArray<FRuntimeRelativeTransform>& RelativeTransforms)
+{
+	check(SceneComponents.Num() == RelativeTransforms.Num());
+
+	TSet<const USceneComponent*> BatchedComponents;
+	BatchedComponents.Reserve(SceneComponents.Num());
+	for (const USceneComponent* SceneComponent : SceneComponents)
+	{
+		if (SceneComponent != nullptr)
+		{
+			BatchedComponents.Add(SceneComponent);
+		}
+	}
+
+	// Sort parent-before-child by attachment depth; a component with a batched ancestor is updated along with that ancestor
+	struct FBatchedComponent
+	{
+		USceneComponent* SceneComponent;
+		const FRuntimeRelativeTransform* RelativeTransform;
+		int32 Depth;
+		bool bHasBatchedAncestor;
+	};
+
+	TArray<FBatchedComponent, TInlineAllocator<64>> SortedComponents;
+	SortedComponents.Reserve(SceneComponents.Num());
+	for (int32 ComponentIndex = 0; ComponentIndex < SceneComponents.Num(); ++ComponentIndex)
+	{
+		USceneComponent* SceneComponent = SceneComponents[ComponentIndex];
+		if (SceneComponent == nullptr)
+		{
+			continue;
+		}
+
+		FBatchedComponent& Batched = SortedComponents[SortedComponents.AddUninitialized()];
+		Batched.SceneComponent = SceneComponent;
+		Batched.RelativeTransform = &RelativeTransforms[ComponentIndex];
+		Batched.Depth = 0;
+		Batched.bHasBatchedAncestor = false;
+		for (const USceneComponent* Parent = SceneComponent->GetAttachParent(); Parent != nullptr; Parent = Parent->GetAttachParent())
+		{
+			Batched.bHasBatchedAncestor |= BatchedComponents.Contains(Parent);
+			++Batched.Depth;
+		}
+	}
+
+	SortedComponents.StableSort([](const FBatchedComponent& A, const FBatchedComponent& B) { return A.Depth < B.Depth; });
+
+	// Write every relative transform without propagating anything
+	for (const FBatchedComponent& Batched : SortedComponents)
+	{
+		GetRelativeLocation_DirectMutable(Batched.SceneComponent) = Batched.RelativeTransform->Location;
+		GetRelativeRotation_DirectMutable(Batched.SceneComponent) = Batched.RelativeTransform->Rotation;
+		GetRelativeScale3D_DirectMutable(Batched.SceneComponent) = Batched.RelativeTransform->Scale3D;
+	}
+
+	// A single sweep: updating a component always updates its children, even when its own world transform is unchanged, so the
+	// batched descendants of a component are covered by it
+	for (const FBatchedComponent& Batched : SortedComponents)
+	{
+		if (!Batched.bHasBatchedAncestor)
+		{
+			Batched.SceneComponent->UpdateComponentToWorld();
+		}
+	}
+}
+
 bool FRuntimeDetailsEditorUtils::IsUsingAbsoluteLocation(USceneComponent* SceneComponent)
 {
 #if UE_4_24_OR_LATER
@@ -7,12 +7,22 @@
 #include "ARDUEFeatures.h"
 #include "GameFramework/Actor.h"
 
+/** The relative transform of a scene component as its properties store it, so that rotations are kept as entered */
+struct FRuntimeRelativeTransform
+{
+	FVector Location;
+	FRotator Rotation;
+	FVector Scale3D;
+};
+
 class FRuntimeDetailsEditorUtils
 {
 public:
 	/**
 	 * Deletes the indicated components and identifies the component that should be selected following the operation.
 	 * Note: Does not take care of the actual selection of a new component. It only identifies which component should be selected.
+	 * The components are deleted as one batch: the component to select is found once, and surviving children of deleted
+	 * components are reattached once, directly to their closest surviving ancestor.
 	 * 
 	 * @param ComponentsToDelete The list of components to delete
 	 * @param OutComponentToSelect The component that should be selected after the deletion
@@ -42,6 +52,19 @@ public:
 	static FVector GetRelativeScale3D(USceneComponent* SceneComponent);
 	static void SetRelativeScale3D(USceneComponent* SceneComponent, FVector RelativeScale3D);
 
+	/** @return The relative transform of the given component */
+	static FRuntimeRelativeTransform GetRelativeTransform(USceneComponent* SceneComponent);
+
+	/**
+	 * Sets the relative transforms of several components at once. The components are sorted parent-before-child and all of the
+	 * relative transforms are written first; the world transforms are then updated in a single sweep, from each component that
+	 * has no ancestor in the batch, so that every affected component is updated exactly once.
+	 *
+	 * @param SceneComponents		The components to move
+	 * @param RelativeTransforms	The new relative transform of each component, in the same order
+	 */
+	static void SetRelativeTransforms(const TArray<USceneComponent*>& SceneComponents, const TArray<FRuntimeRelativeTransform>& RelativeTransforms);
+
 	static bool IsUsingAbsoluteLocation(USceneComponent* SceneComponent);
 	static bool IsUsingAbsoluteRotation(USceneComponent* SceneComponent);
 	static bool IsUsingAbsoluteScale(USceneComponent* SceneComponent);
@@ -23,12 +23,51 @@
 #include "LevelEditor.h"
 #include "Kismet2/KismetEditorUtilities.h"
 #include "SSCSRuntimeEditor.h"
+#include "SRuntimePropertyWatchList.h"
+#include "RuntimeComponentTransformDetails.h"
+#include "RuntimeActorSnapshot.h"
 #include "PropertyEditorModule.h"
 #include "IDetailsView.h"
 //#include "LevelEditorGenericDetails.h"
 #include "ScopedTransaction.h"
 #include "SourceCodeNavigation.h"
 #include "Widgets/Docking/SDockTab.h"
+#include "Framework/Docking/TabManager.h"
+#include "Framework/Application/SlateApplication.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SButton.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UnrealType.h"
+#include "ActorRuntimeDetailsStats.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogActorRuntimeDetails, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Details SetObjects"), STAT_ActorRuntimeDetails_SetObjects, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details ProcessPendingRefresh"), STAT_ActorRuntimeDetails_ProcessPendingRefresh, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details OnEditorSelectionChanged"), STAT_ActorRuntimeDetails_OnEditorSelectionChanged, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details OnTreeSelectionChanged"), STAT_ActorRuntimeDetails_OnTreeSelectionChanged, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details UpdateComponentTreeFromEditorSelection"), STAT_ActorRuntimeDetails_UpdateComponentTreeFromEditorSelection, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details SampleLiveWatch"), STAT_ActorRuntimeDetails_SampleLiveWatch, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("Details UpdateComponentWarnings"), STAT_ActorRuntimeDetails_UpdateComponentWarnings, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Details View Resets"), STAT_ActorRuntimeDetails_DetailsViewResets, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Details Refresh Requests"), STAT_ActorRuntimeDetails_RefreshRequests, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Details Refresh Requests Coalesced"), STAT_ActorRuntimeDetails_RefreshRequestsCoalesced, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Details Refreshes Processed"), STAT_ActorRuntimeDetails_RefreshesProcessed, STATGROUP_ActorRuntimeDetails);
+
+static TAutoConsoleVariable<int32> CVarLiveWatch(
+	TEXT("ActorRuntimeDetails.LiveWatch"),
+	0,
+	TEXT("If non-zero, Runtime Details panels start in live watch mode and refresh when gameplay changes the displayed values."));
+
+static TAutoConsoleVariable<float> CVarLiveWatchRate(
+	TEXT("ActorRuntimeDetails.LiveWatchRate"),
+	10.f,
+	TEXT("Number of times per second the Runtime Details live watch samples the properties of the displayed objects."));
+
+static TAutoConsoleVariable<float> CVarLiveWatchMaxRebuildRate(
+	TEXT("ActorRuntimeDetails.LiveWatchMaxRebuildRate"),
+	2.f,
+	TEXT("Maximum number of times per second the Runtime Details live watch rebuilds the details view; changes sampled in between are merged into the next rebuild."));
 
 class SActorRuntimeDetailsUneditableComponentWarning : public SCompoundWidget
 {
@@ -86,12 +125,26 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 	bSelectionGuard = false;
 	bShowingRootActorNodeSelected = false;
 	bSelectedComponentRecompiled = false;
+	PendingRefresh = EActorRuntimeDetailsRefresh::None;
+	bRefreshDeferredUntilForeground = false;
+	NumRefreshRequests = 0;
+	NumProcessedRefreshes = 0;
+	bLiveWatchEnabled = false;
+	LiveWatchTimerPeriod = 0.f;
+	bLiveWatchRebuildPending = false;
+	LastLiveWatchRebuildTime = 0.0;
+	ActorSnapshot = MakeUnique<FRuntimeActorSnapshot>();
 
 	USelection::SelectionChangedEvent.AddRaw(this, &SActorRuntimeDetails::OnEditorSelectionChanged);
+	FEditorDelegates::PostPIEStarted.AddRaw(this, &SActorRuntimeDetails::OnPIEStarted);
+	FEditorDelegates::EndPIE.AddRaw(this, &SActorRuntimeDetails::OnPIEEnded);
+	GEditor->OnBlueprintCompiled().AddRaw(this, &SActorRuntimeDetails::OnAnyBlueprintCompiled);
 	
 	FLevelEditorModule& LevelEditor = FModuleManager::GetModuleChecked<FLevelEditorModule>("LevelEditor");
 	LevelEditor.OnComponentsEdited().AddRaw(this, &SActorRuntimeDetails::OnComponentsEditedInWorld);
 
+	TabForegroundedHandle = FGlobalTabmanager::Get()->OnTabForegrounded_Subscribe(FOnActiveTabChanged::FDelegate::CreateRaw(this, &SActorRuntimeDetails::OnTabForegrounded));
+
 	FPropertyEditorModule& PropPlugin = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	FDetailsViewArgs DetailsViewArgs;
 	DetailsViewArgs.bUpdatesFromSelection = true;
@@ -122,6 +175,13 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 	DetailsView->SetIsPropertyEditingEnabledDelegate(FIsPropertyEditingEnabled::CreateSP(this, &SActorRuntimeDetails::IsPropertyEditingEnabled));
 	DetailsView->SetOnObjectArrayChanged(FOnObjectArrayChanged::CreateSP(this, &SActorRuntimeDetails::OnDetailsViewObjectArrayChanged));
 
+	// Transform edits on components skip the generic property change pipeline, which would reregister them on every spin
+	DetailsView->RegisterInstancedCustomPropertyLayout(USceneComponent::StaticClass(), FOnGetDetailCustomizationInstance::CreateStatic(&FRuntimeComponentTransformDetails::MakeInstance));
+
+	// Numeric rows get a button that pins them to the watch list below the details
+	WatchList = SNew(SRuntimePropertyWatchList);
+	DetailsView->SetExtensionHandler(MakeShareable(new FRuntimePropertyWatchExtensionHandler(WatchList.ToSharedRef())));
+
 
 	// Set up a delegate to call to add generic details to the view
 	//DetailsView->SetGenericLayoutDetailsDelegate(FOnGetDetailCustomizationInstance::CreateStatic(&FLevelEditorGenericDetails::MakeInstance));
@@ -141,7 +201,7 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 	ComponentsBox->SetContent(SCSRuntimeEditor.ToSharedRef());
 
 	TextBlock = SNew(STextBlock)
-		.Visibility(this, &SActorRuntimeDetails::GetPlayInGameTipVisibility)
+		.Visibility(GEditor->PlayWorld == nullptr ? EVisibility::Visible : EVisibility::Collapsed)
 		.Text(NSLOCTEXT("SActorRuntimeDetails", "PlayGameInEditorTip", "Play game in editor."))
 		.ShadowOffset(FVector2D(1, 1));
 
@@ -159,7 +219,55 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 		.Padding(0.0f, 0.0f, 0.0f, 2.0f)
 		.AutoHeight()
 		[
-			DetailsView->GetNameAreaWidget().ToSharedRef()
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			[
+				DetailsView->GetNameAreaWidget().ToSharedRef()
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SCheckBox)
+				.Style(FEditorStyle::Get(), "ToggleButtonCheckbox")
+				.IsChecked(this, &SActorRuntimeDetails::GetLiveWatchCheckState)
+				.OnCheckStateChanged(this, &SActorRuntimeDetails::OnLiveWatchCheckStateChanged)
+				.ToolTipText(NSLOCTEXT("SActorRuntimeDetails", "LiveWatchTooltip", "Follow values changed by gameplay. The displayed properties are sampled periodically (ActorRuntimeDetails.LiveWatchRate) and the view is refreshed only when they change."))
+				[
+					SNew(STextBlock)
+					.Text(NSLOCTEXT("SActorRuntimeDetails", "LiveWatch", "Live"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FEditorStyle::Get(), "FlatButton")
+				.OnClicked(this, &SActorRuntimeDetails::OnCaptureSnapshotClicked)
+				.ToolTipText(NSLOCTEXT("SActorRuntimeDetails", "CaptureSnapshotTooltip", "Capture the edited properties of the displayed Actor and its components, so that they can be restored later."))
+				[
+					SNew(STextBlock)
+					.Text(NSLOCTEXT("SActorRuntimeDetails", "CaptureSnapshot", "Snapshot"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(2.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FEditorStyle::Get(), "FlatButton")
+				.IsEnabled(this, &SActorRuntimeDetails::IsRestoreSnapshotEnabled)
+				.OnClicked(this, &SActorRuntimeDetails::OnRestoreSnapshotClicked)
+				.ToolTipText(NSLOCTEXT("SActorRuntimeDetails", "RestoreSnapshotTooltip", "Restore the properties captured by the last snapshot of this Actor in one undoable step."))
+				[
+					SNew(STextBlock)
+					.Text(NSLOCTEXT("SActorRuntimeDetails", "RestoreSnapshot", "Restore"))
+				]
+			]
 		]
 		+SVerticalBox::Slot()
 		[
@@ -172,27 +280,27 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 				.AutoHeight()
 				.Padding( FMargin( 0,0,0,1) )
 				[
-					SNew(SActorRuntimeDetailsUneditableComponentWarning)
-					.Visibility(this, &SActorRuntimeDetails::GetUCSComponentWarningVisibility)
-					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "BlueprintUCSComponentWarning", "Components created by the User Construction Script can only be edited in the <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">Blueprint</>"))
+					SAssignNew(UCSComponentWarning, SActorRuntimeDetailsUneditableComponentWarning)
+					.Visibility(EVisibility::Collapsed)
+					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "BlueprintUCSComponentRuntimeWarning", "Edits to components created by the User Construction Script only apply to this instance; to keep them, change the <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">Blueprint</>"))
 					.OnHyperlinkClicked(this, &SActorRuntimeDetails::OnBlueprintedComponentWarningHyperlinkClicked)
 				]
 				+SVerticalBox::Slot()
 				.AutoHeight()
 				.Padding( FMargin( 0,0,0,1) )
 				[
-					SNew(SActorRuntimeDetailsUneditableComponentWarning)
-					.Visibility(this, &SActorRuntimeDetails::GetInheritedBlueprintComponentWarningVisibility)
-					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "BlueprintUneditableInheritedComponentWarning", "Components flagged as not editable when inherited must be edited in the <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">Blueprint</>"))
+					SAssignNew(InheritedBlueprintComponentWarning, SActorRuntimeDetailsUneditableComponentWarning)
+					.Visibility(EVisibility::Collapsed)
+					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "BlueprintUneditableInheritedComponentRuntimeWarning", "Edits to components flagged as not editable when inherited only apply to this instance; to keep them, change the <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">Blueprint</>"))
 					.OnHyperlinkClicked(this, &SActorRuntimeDetails::OnBlueprintedComponentWarningHyperlinkClicked)
 				]
 				+SVerticalBox::Slot()
 				.AutoHeight()
 				.Padding( FMargin( 0,0,0,1) )
 				[
-					SNew(SActorRuntimeDetailsUneditableComponentWarning)
-					.Visibility(this, &SActorRuntimeDetails::GetNativeComponentWarningVisibility)
-					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "UneditableNativeComponentWarning", "Native components are editable when declared as a UProperty in <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">C++</>"))
+					SAssignNew(NativeComponentWarning, SActorRuntimeDetailsUneditableComponentWarning)
+					.Visibility(EVisibility::Collapsed)
+					.WarningText(NSLOCTEXT("SActorRuntimeDetails", "UneditableNativeComponentRuntimeWarning", "Edits to this native component only apply to this instance; its defaults are editable once it is declared as a UProperty in <a id=\"HyperlinkDecorator\" style=\"DetailsView.BPMessageHyperlinkStyle\">C++</>"))
 					.OnHyperlinkClicked(this, &SActorRuntimeDetails::OnNativeComponentWarningHyperlinkClicked)
 				]
 				+ SVerticalBox::Slot()
@@ -213,6 +321,18 @@ void SActorRuntimeDetails::Construct(const FArguments& InArgs, const FName TabId
 	[
 		ComponentsBox.ToSharedRef()
 	];
+
+	DetailsSplitter->AddSlot()
+	.Value(.2f)
+	[
+		SNew(SBox)
+		.Visibility(this, &SActorRuntimeDetails::GetWatchListVisibility)
+		[
+			WatchList.ToSharedRef()
+		]
+	];
+
+	SetLiveWatchEnabled(CVarLiveWatch.GetValueOnGameThread() != 0);
 }
 
 SActorRuntimeDetails::~SActorRuntimeDetails()
@@ -220,8 +340,11 @@ SActorRuntimeDetails::~SActorRuntimeDetails()
 	if (GEditor)
 	{
 		GEditor->UnregisterForUndo(this);
+		GEditor->OnBlueprintCompiled().RemoveAll(this);
 	}
 	USelection::SelectionChangedEvent.RemoveAll(this);
+	FEditorDelegates::PostPIEStarted.RemoveAll(this);
+	FEditorDelegates::EndPIE.RemoveAll(this);
 	RemoveBPComponentCompileEventDelegate();
 
 	FLevelEditorModule* LevelEditor = FModuleManager::GetModulePtr<FLevelEditorModule>("LevelEditor");
@@ -229,6 +352,11 @@ SActorRuntimeDetails::~SActorRuntimeDetails()
 	{
 		LevelEditor->OnComponentsEdited().RemoveAll(this);
 	}
+
+	if (FSlateApplication::IsInitialized())
+	{
+		FGlobalTabmanager::Get()->OnTabForegrounded_Unsubscribe(TabForegroundedHandle);
+	}
 }
 
 void SActorRuntimeDetails::OnDetailsViewObjectArrayChanged(const FString& InTitle, const TArray<UObject*>& InObjects)
@@ -242,44 +370,497 @@ void SActorRuntimeDetails::OnDetailsViewObjectArrayChanged(const FString& InTitl
 
 void SActorRuntimeDetails::SetObjects(const TArray<UObject*>& InObjects, bool bForceRefresh)
 {
+	SetSelection(MakeSelection(InObjects), bForceRefresh);
+}
+
+TSharedRef<const FActorRuntimeDetailsSelection> SActorRuntimeDetails::MakeSelection(const TArray<UObject*>& InObjects)
+{
+	TSharedRef<FActorRuntimeDetailsSelection> Selection = MakeShared<FActorRuntimeDetailsSelection>();
+	Selection->Reserve(InObjects.Num());
+	for (UObject* Object : InObjects)
+	{
+		Selection->Add(Object);
+	}
+	return Selection;
+}
+
+void SActorRuntimeDetails::SetSelection(const TSharedRef<const FActorRuntimeDetailsSelection>& InSelection, bool bForceRefresh)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_SetObjects);
+
 	if (GEditor->PlayWorld == nullptr)
 		return;
 
 	if(!DetailsView->IsLocked())
 	{
-		DetailsView->SetObjects(InObjects, bForceRefresh);
+		// The details view and tree are only updated on the next tick, so several selection changes in a frame cost a single refresh
+		PendingSelection = InSelection;
+
+		RequestRefresh(bForceRefresh ? EActorRuntimeDetailsRefresh::Objects | EActorRuntimeDetailsRefresh::ForceDetails : EActorRuntimeDetailsRefresh::Objects);
+
+		if (bRefreshDeferredUntilForeground)
+		{
+			TSharedPtr<SDockTab> Tab = OwnerTab.Pin();
+			if (Tab.IsValid())
+			{
+				Tab->FlashTab();
+			}
+		}
+	}
+}
+
+bool SActorRuntimeDetails::IsInForegroundTab() const
+{
+	TSharedPtr<SDockTab> Tab = OwnerTab.Pin();
+	if (!Tab.IsValid() && DetailsView->GetHostTabManager().IsValid())
+	{
+		Tab = DetailsView->GetHostTabManager()->FindExistingLiveTab(DetailsView->GetIdentifier());
+		OwnerTab = Tab;
+	}
+
+	return !Tab.IsValid() || Tab->IsForeground();
+}
+
+void SActorRuntimeDetails::OnTabForegrounded(TSharedPtr<SDockTab> NewForegroundTab, TSharedPtr<SDockTab> BackgroundedTab)
+{
+	if (bRefreshDeferredUntilForeground && NewForegroundTab.IsValid() && NewForegroundTab == OwnerTab.Pin())
+	{
+		bRefreshDeferredUntilForeground = false;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SActorRuntimeDetails::ProcessPendingRefresh));
+	}
+}
+
+void SActorRuntimeDetails::RequestRefresh(EActorRuntimeDetailsRefresh InRefresh)
+{
+	++NumRefreshRequests;
+	INC_DWORD_STAT(STAT_ActorRuntimeDetails_RefreshRequests);
+	if (PendingRefresh != EActorRuntimeDetailsRefresh::None)
+	{
+		// Merged into the refresh that is already pending
+		INC_DWORD_STAT(STAT_ActorRuntimeDetails_RefreshRequestsCoalesced);
+	}
+
+	// A panel in a background tab keeps accumulating work without a timer, and runs it all once its tab is foregrounded
+	if (PendingRefresh == EActorRuntimeDetailsRefresh::None && !bRefreshDeferredUntilForeground)
+	{
+		if (IsInForegroundTab())
+		{
+			RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SActorRuntimeDetails::ProcessPendingRefresh));
+		}
+		else
+		{
+			bRefreshDeferredUntilForeground = true;
+		}
+	}
+
+	PendingRefresh |= InRefresh;
+}
+
+EActiveTimerReturnType SActorRuntimeDetails::ProcessPendingRefresh(double InCurrentTime, float InDeltaTime)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_ProcessPendingRefresh);
+
+	// The tab was sent to the background since the refresh was requested
+	if (!IsInForegroundTab())
+	{
+		bRefreshDeferredUntilForeground = true;
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Anything requested while processing is picked up on the next tick
+	const EActorRuntimeDetailsRefresh Refresh = PendingRefresh;
+	PendingRefresh = EActorRuntimeDetailsRefresh::None;
+
+	if (GEditor->PlayWorld == nullptr || Refresh == EActorRuntimeDetailsRefresh::None)
+	{
+		PendingSelection.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	++NumProcessedRefreshes;
+	INC_DWORD_STAT(STAT_ActorRuntimeDetails_RefreshesProcessed);
+
+	// Enable the selection guard to prevent OnTreeSelectionChanged() from altering the editor's component selection
+	TGuardValue<bool> SelectionGuard(bSelectionGuard, true);
+
+	const bool bForceDetails = EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::ForceDetails);
+	bool bUpdateTree = EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::Tree);
+
+	if (EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::Objects) && !DetailsView->IsLocked())
+	{
+		TArray<UObject*> Objects;
+		if (PendingSelection.IsValid())
+		{
+			Objects.Reserve(PendingSelection->Num());
+			for (const TWeakObjectPtr<UObject>& Object : *PendingSelection)
+			{
+				if (Object.IsValid())
+				{
+					Objects.Add(Object.Get());
+				}
+			}
+		}
+		PendingSelection.Reset();
+
+		INC_DWORD_STAT(STAT_ActorRuntimeDetails_DetailsViewResets);
+		DetailsView->SetObjects(Objects, bForceDetails);
 
 		bool bShowingComponents = false;
 
-		if(InObjects.Num() == 1 && FKismetEditorUtilities::CanCreateBlueprintOfClass(InObjects[0]->GetClass()))
+		// With several Actors selected, the tree shows the components they share, rooted at the primary selection
+		TArray<AActor*> MergedActors;
+		AActor* Actor = GetSelectedActorInEditor();
+		if(Actor && Objects.Contains(Actor) && FKismetEditorUtilities::CanCreateBlueprintOfClass(Actor->GetClass()))
 		{
-			AActor* Actor = GetSelectedActorInEditor();
-			if(Actor)
+			bShowingComponents = true;
+			for (UObject* Object : Objects)
+			{
+				AActor* OtherActor = Cast<AActor>(Object);
+				if (OtherActor == nullptr)
+				{
+					bShowingComponents = false;
+					break;
+				}
+				else if (OtherActor != Actor)
+				{
+					MergedActors.Add(OtherActor);
+				}
+			}
+
+			if(bShowingComponents)
 			{
 				LockedActorSelection = Actor;
-				bShowingComponents = true;
 
 				// Update the tree if a new actor is selected
-				if(GEditor->GetSelectedComponentCount() == 0)
-				{
-					// Enable the selection guard to prevent OnTreeSelectionChanged() from altering the editor's component selection
-					TGuardValue<bool> SelectionGuard(bSelectionGuard, true);
-					SCSRuntimeEditor->UpdateTree();
-				}
+				bUpdateTree |= GEditor->GetSelectedComponentCount() == 0;
 			}
 		}
 
+		if (!bShowingComponents)
+		{
+			MergedActors.Reset();
+		}
+
+		bUpdateTree |= SCSRuntimeEditor->SetMergedActors(MergedActors) && bShowingComponents;
+
 		ComponentsBox->SetVisibility(bShowingComponents ? EVisibility::Visible : EVisibility::Collapsed);
+	}
+
+	if (bUpdateTree)
+	{
+		SCSRuntimeEditor->UpdateTree();
+	}
+
+	if (EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::TreeSelection))
+	{
+		TGuardValue<bool> RecompiledGuard(bSelectedComponentRecompiled, bSelectedComponentRecompiled || bForceDetails);
+		UpdateComponentTreeFromEditorSelection();
+	}
+
+	if (bForceDetails && !EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::Objects | EActorRuntimeDetailsRefresh::TreeSelection))
+	{
+		// Nothing above reset the details view, but its rows are out of date
+		INC_DWORD_STAT(STAT_ActorRuntimeDetails_DetailsViewResets);
+		DetailsView->ForceRefresh();
+	}
+
+	if (EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::SelectionFlags))
+	{
+		// Ensure the selection flags are up to date for the components in the selected actors
+		for (FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
+		{
+			AActor* Actor = CastChecked<AActor>(*It);
+			GUnrealEd->SetActorSelectionFlags(Actor);
+		}
+	}
+
+	if (EnumHasAnyFlags(Refresh, EActorRuntimeDetailsRefresh::Pivot) && GetSelectedActorInEditor())
+	{
+		// Update the pivot (widget) as the current selection may be a component within the Actor instance
+		GUnrealEd->UpdatePivotLocationForSelection();
+	}
+
+	return EActiveTimerReturnType::Stop;
+}
+
+void SActorRuntimeDetails::SetLiveWatchEnabled(bool bInEnabled)
+{
+	if (bLiveWatchEnabled == bInEnabled)
+		return;
+
+	bLiveWatchEnabled = bInEnabled;
+
+	if (bLiveWatchEnabled)
+	{
+		RegisterLiveWatchTimer();
+	}
+	else
+	{
+		if (LiveWatchTimerHandle.IsValid())
+		{
+			UnRegisterActiveTimer(LiveWatchTimerHandle.ToSharedRef());
+			LiveWatchTimerHandle.Reset();
+		}
+
+		LiveWatchObjects.Empty();
+		LiveWatchProperties.Empty();
+		LiveWatchSnapshot.Empty();
+		bLiveWatchRebuildPending = false;
+	}
+}
+
+void SActorRuntimeDetails::RegisterLiveWatchTimer()
+{
+	if (LiveWatchTimerHandle.IsValid())
+	{
+		UnRegisterActiveTimer(LiveWatchTimerHandle.ToSharedRef());
+	}
 
-		if(DetailsView->GetHostTabManager().IsValid())
+	LiveWatchTimerPeriod = 1.f / FMath::Clamp(CVarLiveWatchRate.GetValueOnGameThread(), 0.1f, 120.f);
+	LiveWatchTimerHandle = RegisterActiveTimer(LiveWatchTimerPeriod, FWidgetActiveTimerDelegate::CreateSP(this, &SActorRuntimeDetails::SampleLiveWatch));
+}
+
+EActiveTimerReturnType SActorRuntimeDetails::SampleLiveWatch(double InCurrentTime, float InDeltaTime)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_SampleLiveWatch);
+
+	if (!bLiveWatchEnabled)
+	{
+		LiveWatchTimerHandle.Reset();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	// Pick up changes to the sample rate; this timer is stopped by returning, so it must not be unregistered from within its own callback
+	if (LiveWatchTimerPeriod != 1.f / FMath::Clamp(CVarLiveWatchRate.GetValueOnGameThread(), 0.1f, 120.f))
+	{
+		LiveWatchTimerHandle.Reset();
+		RegisterLiveWatchTimer();
+		return EActiveTimerReturnType::Stop;
+	}
+
+	if (GEditor->PlayWorld == nullptr)
+	{
+		LiveWatchObjects.Reset();
+		return EActiveTimerReturnType::Continue;
+	}
+
+	// A different set of objects only needs a new baseline, the details view was already rebuilt for it
+	const TArray<TWeakObjectPtr<UObject>>& SelectedObjects = DetailsView->GetSelectedObjects();
+	bool bObjectsChanged = SelectedObjects.Num() != LiveWatchObjects.Num();
+	for (int32 ObjectIndex = 0; !bObjectsChanged && ObjectIndex < SelectedObjects.Num(); ++ObjectIndex)
+	{
+		bObjectsChanged = SelectedObjects[ObjectIndex] != LiveWatchObjects[ObjectIndex].Object;
+	}
+
+	if (bObjectsChanged)
+	{
+		RebuildLiveWatch(SelectedObjects);
+		bLiveWatchRebuildPending = false;
+		return EActiveTimerReturnType::Continue;
+	}
+
+	bool bLayoutChanged = false;
+	for (const FLiveWatchObject& WatchedObject : LiveWatchObjects)
+	{
+		const UObject* Object = WatchedObject.Object.Get();
+		if (Object == nullptr)
 		{
-			TSharedPtr<SDockTab> Tab = DetailsView->GetHostTabManager()->FindExistingLiveTab(DetailsView->GetIdentifier());
-			if (Tab.IsValid() && !Tab->IsForeground() )
+			continue;
+		}
+
+		// Every sample is taken, so that the snapshot is current for the next tick
+		for (int32 PropertyIndex = WatchedObject.FirstProperty; PropertyIndex < WatchedObject.FirstProperty + WatchedObject.NumProperties; ++PropertyIndex)
+		{
+			const FLiveWatchProperty& Watched = LiveWatchProperties[PropertyIndex];
+			bLayoutChanged |= SampleLiveWatchProperty(Watched, Object, LiveWatchSnapshot.GetData() + Watched.SnapshotOffset);
+		}
+	}
+
+	// Container sizes or object references changed, so the rows themselves are out of date. IDetailsView can only rebuild as a
+	// whole, so gameplay that changes them every frame is merged into at most ActorRuntimeDetails.LiveWatchMaxRebuildRate rebuilds.
+	bLiveWatchRebuildPending |= bLayoutChanged;
+	if (bLiveWatchRebuildPending && InCurrentTime - LastLiveWatchRebuildTime >= 1.0 / FMath::Clamp(CVarLiveWatchMaxRebuildRate.GetValueOnGameThread(), 0.1f, 120.f))
+	{
+		bLiveWatchRebuildPending = false;
+		LastLiveWatchRebuildTime = InCurrentTime;
+		RequestRefresh(EActorRuntimeDetailsRefresh::ForceDetails);
+	}
+
+	return EActiveTimerReturnType::Continue;
+}
+
+void SActorRuntimeDetails::RebuildLiveWatch(const TArray<TWeakObjectPtr<UObject>>& InObjects)
+{
+	LiveWatchObjects.Reset(InObjects.Num());
+	LiveWatchProperties.Reset();
+	LiveWatchSnapshot.Reset();
+
+	for (const TWeakObjectPtr<UObject>& WeakObject : InObjects)
+	{
+		FLiveWatchObject& WatchedObject = LiveWatchObjects[LiveWatchObjects.AddUninitialized()];
+		WatchedObject.Object = WeakObject;
+		WatchedObject.FirstProperty = LiveWatchProperties.Num();
+		WatchedObject.NumProperties = 0;
+
+		const UObject* Object = WeakObject.Get();
+		if (Object == nullptr)
+		{
+			continue;
+		}
+
+		AddLiveWatchProperties(Object->GetClass(), 0, WatchedObject);
+
+		for (int32 PropertyIndex = WatchedObject.FirstProperty; PropertyIndex < LiveWatchProperties.Num(); ++PropertyIndex)
+		{
+			const FLiveWatchProperty& Watched = LiveWatchProperties[PropertyIndex];
+			SampleLiveWatchProperty(Watched, Object, LiveWatchSnapshot.GetData() + Watched.SnapshotOffset);
+		}
+	}
+}
+
+void SActorRuntimeDetails::AddLiveWatchProperties(const UStruct* InStruct, int32 InContainerOffset, FLiveWatchObject& InOutWatchedObject)
+{
+	for (TFieldIterator<UProperty> It(InStruct); It; ++It)
+	{
+		UProperty* Property = *It;
+
+		// Only properties the details view shows are worth watching
+		if (!Property->HasAnyPropertyFlags(CPF_Edit) || Property->HasAnyPropertyFlags(CPF_Deprecated))
+		{
+			continue;
+		}
+
+		FLiveWatchProperty Watched;
+		Watched.Property = Property;
+		Watched.ContainerOffset = InContainerOffset;
+
+		if (Property->IsA<UArrayProperty>())
+		{
+			Watched.Value = ELiveWatchValue::ArrayNum;
+			Watched.SnapshotSize = sizeof(int32) * Property->ArrayDim;
+		}
+		else if (Property->IsA<UMapProperty>())
+		{
+			Watched.Value = ELiveWatchValue::MapNum;
+			Watched.SnapshotSize = sizeof(int32) * Property->ArrayDim;
+		}
+		else if (Property->IsA<USetProperty>())
+		{
+			Watched.Value = ELiveWatchValue::SetNum;
+			Watched.SnapshotSize = sizeof(int32) * Property->ArrayDim;
+		}
+		else if (Property->IsA<UObjectPropertyBase>() && Property->HasAnyPropertyFlags(CPF_HasGetValueTypeHash))
+		{
+			// Soft and lazy references cache the object they last resolved to, so their bytes change without the reference changing
+			Watched.Value = ELiveWatchValue::Hash;
+			Watched.SnapshotSize = sizeof(uint32) * Property->ArrayDim;
+		}
+		else if (const UStructProperty* StructProperty = Cast<UStructProperty>(Property))
+		{
+			// The members of a struct are shown as rows of their own, so the containers and references within it are watched too
+			for (int32 ArrayIndex = 0; ArrayIndex < Property->ArrayDim; ++ArrayIndex)
 			{
-				Tab->FlashTab();
+				AddLiveWatchProperties(StructProperty->Struct, InContainerOffset + Property->GetOffset_ForInternal() + ArrayIndex * Property->ElementSize, InOutWatchedObject);
 			}
+			continue;
+		}
+		else
+		{
+			// The row of any other property reads its value live, so a change doesn't need a rebuild
+			continue;
 		}
+
+		Watched.SnapshotOffset = LiveWatchSnapshot.AddUninitialized(Watched.SnapshotSize);
+		LiveWatchProperties.Add(Watched);
+		++InOutWatchedObject.NumProperties;
+	}
+}
+
+bool SActorRuntimeDetails::SampleLiveWatchProperty(const FLiveWatchProperty& InWatched, const UObject* InObject, uint8* InOutSnapshot)
+{
+	const uint8* ValuePtr = InWatched.Property->ContainerPtrToValuePtr<uint8>((const uint8*)InObject + InWatched.ContainerOffset);
+
+	// Snapshot ranges are packed, so the element counts and hashes may not be aligned
+	bool bChanged = false;
+	for (int32 ArrayIndex = 0; ArrayIndex < InWatched.Property->ArrayDim; ++ArrayIndex)
+	{
+		const uint8* ElementPtr = ValuePtr + ArrayIndex * InWatched.Property->ElementSize;
+
+		int32 Num = 0;
+		switch (InWatched.Value)
+		{
+		case ELiveWatchValue::ArrayNum:
+			Num = FScriptArrayHelper(static_cast<const UArrayProperty*>(InWatched.Property), ElementPtr).Num();
+			break;
+		case ELiveWatchValue::MapNum:
+			Num = FScriptMapHelper(static_cast<const UMapProperty*>(InWatched.Property), ElementPtr).Num();
+			break;
+		case ELiveWatchValue::SetNum:
+			Num = FScriptSetHelper(static_cast<const USetProperty*>(InWatched.Property), ElementPtr).Num();
+			break;
+		case ELiveWatchValue::Hash:
+			Num = (int32)InWatched.Property->GetValueTypeHash(ElementPtr);
+			break;
+		default:
+			break;
+		}
+
+		uint8* SnapshotNum = InOutSnapshot + ArrayIndex * sizeof(int32);
+		if (FMemory::Memcmp(SnapshotNum, &Num, sizeof(int32)) != 0)
+		{
+			FMemory::Memcpy(SnapshotNum, &Num, sizeof(int32));
+			bChanged = true;
+		}
+	}
+
+	return bChanged;
+}
+
+ECheckBoxState SActorRuntimeDetails::GetLiveWatchCheckState() const
+{
+	return bLiveWatchEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SActorRuntimeDetails::OnLiveWatchCheckStateChanged(ECheckBoxState InState)
+{
+	SetLiveWatchEnabled(InState == ECheckBoxState::Checked);
+}
+
+void SActorRuntimeDetails::CaptureSnapshot()
+{
+	ActorSnapshot->Capture(GetActorContext());
+
+	UE_LOG(LogActorRuntimeDetails, Verbose, TEXT("Captured %d properties (%u bytes) from %s"),
+		ActorSnapshot->GetNumProperties(), (uint32)ActorSnapshot->GetAllocatedSize(), *GetNameSafe(ActorSnapshot->GetActor()));
+}
+
+int32 SActorRuntimeDetails::RestoreSnapshot()
+{
+	const int32 NumRestoredProperties = ActorSnapshot->Restore();
+	if (NumRestoredProperties > 0)
+	{
+		// The restored values are new to the live watch too, which is resampled with the refreshed details view
+		LiveWatchObjects.Reset();
+		RequestRefresh(EActorRuntimeDetailsRefresh::Tree | EActorRuntimeDetailsRefresh::TreeSelection | EActorRuntimeDetailsRefresh::ForceDetails);
 	}
+	return NumRestoredProperties;
+}
+
+FReply SActorRuntimeDetails::OnCaptureSnapshotClicked()
+{
+	CaptureSnapshot();
+	return FReply::Handled();
+}
+
+FReply SActorRuntimeDetails::OnRestoreSnapshotClicked()
+{
+	RestoreSnapshot();
+	return FReply::Handled();
+}
+
+bool SActorRuntimeDetails::IsRestoreSnapshotEnabled() const
+{
+	return ActorSnapshot->GetActor() != nullptr && ActorSnapshot->GetActor() == GetActorContext();
 }
 
 void SActorRuntimeDetails::PostUndo(bool bSuccess)
@@ -287,9 +868,6 @@ void SActorRuntimeDetails::PostUndo(bool bSuccess)
 	if (GEditor->PlayWorld == nullptr)
 		return;
 
-	// Enable the selection guard to prevent OnTreeSelectionChanged() from altering the editor's component selection
-	TGuardValue<bool> SelectionGuard(bSelectionGuard, true);
-
 	if (!DetailsView->IsLocked())
 	{
 		// Make sure the locked actor selection matches the editor selection
@@ -299,20 +877,9 @@ void SActorRuntimeDetails::PostUndo(bool bSuccess)
 			LockedActorSelection = SelectedActor;
 		}
 	}
-	
 
 	// Refresh the tree and update the selection to match the world
-	SCSRuntimeEditor->UpdateTree();
-	UpdateComponentTreeFromEditorSelection();
-
-	AActor* SelectedActor = GetSelectedActorInEditor();
-	if (SelectedActor)
-	{
-		GUnrealEd->SetActorSelectionFlags(SelectedActor);
-
-		// Update the pivot (widget) as the current selection may be a component within the Actor instance
-		GUnrealEd->UpdatePivotLocationForSelection();
-	}
+	RequestRefresh(EActorRuntimeDetailsRefresh::Tree | EActorRuntimeDetailsRefresh::TreeSelection | EActorRuntimeDetailsRefresh::SelectionFlags | EActorRuntimeDetailsRefresh::Pivot);
 }
 
 void SActorRuntimeDetails::PostRedo(bool bSuccess)
@@ -326,6 +893,13 @@ void SActorRuntimeDetails::NotifyPreChange(UProperty* PropertyAboutToChange)
 	AActor* Actor = GetActorContext();
 	if (Actor)
 		Actor->bActorSeamlessTraveled = true;
+
+	// The details view edits every merged instance within the same transaction, so none of their Actors may be reconstructed either
+	for (const TWeakObjectPtr<AActor>& MergedActor : SCSRuntimeEditor->GetMergedActors())
+	{
+		if (MergedActor.IsValid())
+			MergedActor->bActorSeamlessTraveled = true;
+	}
 }
 
 void SActorRuntimeDetails::NotifyPostChange(const FPropertyChangedEvent& PropertyChangedEvent, UProperty* PropertyThatChanged)
@@ -333,6 +907,15 @@ void SActorRuntimeDetails::NotifyPostChange(const FPropertyChangedEvent& Propert
 	AActor* Actor = GetActorContext();
 	if (Actor)
 		Actor->bActorSeamlessTraveled = false;
+
+	for (const TWeakObjectPtr<AActor>& MergedActor : SCSRuntimeEditor->GetMergedActors())
+	{
+		if (MergedActor.IsValid())
+			MergedActor->bActorSeamlessTraveled = false;
+	}
+
+	// The details view already shows the edit, so re-baseline the live watch instead of refreshing for it
+	LiveWatchObjects.Reset();
 }
 
 void SActorRuntimeDetails::OnComponentsEditedInWorld()
@@ -340,15 +923,14 @@ void SActorRuntimeDetails::OnComponentsEditedInWorld()
 	if (GetSelectedActorInEditor() == GetActorContext())
 	{
 		// The component composition of the observed actor has changed, so rebuild the node tree
-		TGuardValue<bool> SelectionGuard(bSelectionGuard, true);
-
-		// Refresh the tree and update the selection to match the world
-		SCSRuntimeEditor->UpdateTree();
+		RequestRefresh(EActorRuntimeDetailsRefresh::Tree);
 	}
 }
 
 void SActorRuntimeDetails::OnEditorSelectionChanged(UObject* Object)
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_OnEditorSelectionChanged);
+
 	if (GEditor->PlayWorld == nullptr)
 		return;
 	
@@ -358,16 +940,13 @@ void SActorRuntimeDetails::OnEditorSelectionChanged(UObject* Object)
 		USelection* Selection = Cast<USelection>(Object);
 		if(Selection == GEditor->GetSelectedComponents() || Selection == GEditor->GetSelectedActors())
 		{
-			UpdateComponentTreeFromEditorSelection();
-
 			if(GEditor->GetSelectedComponentCount() == 0) // An actor was selected
 			{
-				// Ensure the selection flags are up to date for the components in the selected actor
-				for(FSelectionIterator It(GEditor->GetSelectedActorIterator()); It; ++It)
-				{
-					AActor* Actor = CastChecked<AActor>(*It);
-					GUnrealEd->SetActorSelectionFlags(Actor);
-				}
+				RequestRefresh(EActorRuntimeDetailsRefresh::TreeSelection | EActorRuntimeDetailsRefresh::SelectionFlags);
+			}
+			else
+			{
+				RequestRefresh(EActorRuntimeDetailsRefresh::TreeSelection);
 			}
 		}
 	}
@@ -375,7 +954,7 @@ void SActorRuntimeDetails::OnEditorSelectionChanged(UObject* Object)
 
 AActor* SActorRuntimeDetails::GetSelectedActorInEditor() const
 {
-	//@todo this doesn't work w/ multi-select
+	// The primary selection; any other selected Actors are merged into its component tree (see SSCSRuntimeEditor::SetMergedActors)
 	return GEditor->GetSelectedActors()->GetTop<AActor>();
 }
 
@@ -415,6 +994,11 @@ void SActorRuntimeDetails::OnSCSRuntimeEditorRootSelected(AActor* Actor)
 
 void SActorRuntimeDetails::OnSCSRuntimeEditorTreeViewSelectionChanged(const TArray<FSCSRuntimeEditorTreeNodePtrType>& SelectedNodes)
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_OnTreeSelectionChanged);
+
+	// Also done for selection changes made by a refresh, which the guard below ignores
+	UpdateComponentWarnings(SelectedNodes);
+
 	if (!bSelectionGuard && SelectedNodes.Num() > 0)
 	{
 		if( SelectedNodes.Num() > 1 && SelectedBPComponentBlueprint.IsValid() )
@@ -482,7 +1066,10 @@ void SActorRuntimeDetails::OnSCSRuntimeEditorTreeViewSelectionChanged(const TArr
 					}
 				}
 
+				SCSRuntimeEditor->AppendMergedObjects(DetailsObjects);
+
 				const bool bOverrideDetailsLock = true;
+				INC_DWORD_STAT(STAT_ActorRuntimeDetails_DetailsViewResets);
 				DetailsView->SetObjects(DetailsObjects, false, bOverrideDetailsLock);
 			}
 			else
@@ -581,6 +1168,9 @@ void SActorRuntimeDetails::OnSCSRuntimeEditorTreeViewSelectionChanged(const TArr
 
 					SelectedComponents->EndBatchSelectOperation();
 
+					// Only the primary Actor's components are selected in the level, but the details edit all of the merged instances
+					SCSRuntimeEditor->AppendMergedObjects(DetailsObjects);
+					INC_DWORD_STAT(STAT_ActorRuntimeDetails_DetailsViewResets);
 					DetailsView->SetObjects(DetailsObjects);
 
 					GUnrealEd->SetActorSelectionFlags(Actor);
@@ -610,6 +1200,8 @@ void SActorRuntimeDetails::OnSCSRuntimeEditorTreeViewItemDoubleClicked(const TSh
 
 void SActorRuntimeDetails::UpdateComponentTreeFromEditorSelection()
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_UpdateComponentTreeFromEditorSelection);
+
 	if (GEditor->PlayWorld == nullptr)
 		return;
 
@@ -627,7 +1219,7 @@ void SActorRuntimeDetails::UpdateComponentTreeFromEditorSelection()
 		{
 			UActorComponent* Component = CastChecked<UActorComponent>(*It);
 
-			FSCSRuntimeEditorTreeNodePtrType SCSTreeNode = SCSRuntimeEditor->GetNodeFromActorComponent(Component, false);
+			FSCSRuntimeEditorTreeNodePtrType SCSTreeNode = SCSRuntimeEditor->MaterializeNodeFromActorComponent(Component, false);
 			if (SCSTreeNode.IsValid() && SCSTreeNode->GetComponentTemplate())
 			{
 				SCSTreeWidget->RequestScrollIntoView(SCSTreeNode);
@@ -641,6 +1233,8 @@ void SActorRuntimeDetails::UpdateComponentTreeFromEditorSelection()
 
 		if (DetailsObjects.Num() > 0)
 		{
+			SCSRuntimeEditor->AppendMergedObjects(DetailsObjects);
+			INC_DWORD_STAT(STAT_ActorRuntimeDetails_DetailsViewResets);
 			DetailsView->SetObjects(DetailsObjects, bSelectedComponentRecompiled);
 		}
 		else
@@ -727,35 +1321,26 @@ void SActorRuntimeDetails::OnNativeComponentWarningHyperlinkClicked(const FSlate
 	}
 }
 
-EVisibility SActorRuntimeDetails::GetPlayInGameTipVisibility() const
+void SActorRuntimeDetails::OnPIEStarted(bool bIsSimulating)
 {
-	return GEditor->PlayWorld == nullptr ? EVisibility::Visible : EVisibility::Collapsed;
+	TextBlock->SetVisibility(EVisibility::Collapsed);
 }
 
-EVisibility SActorRuntimeDetails::GetUCSComponentWarningVisibility() const
+void SActorRuntimeDetails::OnPIEEnded(bool bIsSimulating)
 {
-	return EVisibility::Collapsed;
-	
-	//bool bIsUneditableBlueprintComponent = false;
+	TextBlock->SetVisibility(EVisibility::Visible);
 
-	//// Check to see if any selected components are inherited from blueprint
-	//for (const FSCSRuntimeEditorTreeNodePtrType& Node : SCSRuntimeEditor->GetSelectedNodes())
-	//{
-	//	if (!Node->IsNative())
-	//	{
-	//		UActorComponent* Component = Node->GetComponentTemplate();
-	//		bIsUneditableBlueprintComponent = Component ? Component->CreationMethod == EComponentCreationMethod::UserConstructionScript : false;
-	//		if (bIsUneditableBlueprintComponent)
-	//		{
-	//			break;
-	//		}
-	//	}
-	//}
+	// The captured Actor is going away, and its values must be released while their classes still exist
+	ActorSnapshot->Reset();
+}
 
-	//return bIsUneditableBlueprintComponent ? EVisibility::Visible : EVisibility::Collapsed;
+void SActorRuntimeDetails::OnAnyBlueprintCompiled()
+{
+	// A recompile may replace the properties the snapshot's values were captured through, even when it keeps their class
+	ActorSnapshot->Reset();
 }
 
-bool NotEditableSetByBlueprint(UActorComponent* Component)
+static bool NotEditableSetByBlueprint(UActorComponent* Component)
 {
 	// Determine if it is locked out from a blueprint or from the native
 	UActorComponent* Archetype = CastChecked<UActorComponent>(Component->GetArchetype());
@@ -779,52 +1364,67 @@ bool NotEditableSetByBlueprint(UActorComponent* Component)
 	return false;
 }
 
-EVisibility SActorRuntimeDetails::GetInheritedBlueprintComponentWarningVisibility() const
+void SActorRuntimeDetails::UpdateComponentWarnings(const TArray<FSCSRuntimeEditorTreeNodePtrType>& SelectedNodes)
 {
-	return EVisibility::Collapsed;
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_UpdateComponentWarnings);
 
-	//bool bIsUneditableBlueprintComponent = false;
+	bool bIsUCSComponent = false;
+	bool bIsUneditableBlueprintComponent = false;
+	bool bIsUneditableNative = false;
 
-	//// Check to see if any selected components are inherited from blueprint
-	//for (const FSCSRuntimeEditorTreeNodePtrType& Node : SCSRuntimeEditor->GetSelectedNodes())
-	//{
-	//	if (!Node->IsNative())
-	//	{
-	//		if (UActorComponent* Component = Node->GetComponentTemplate())
-	//		{
-	//			if (!Component->IsEditableWhenInherited() && Component->CreationMethod == EComponentCreationMethod::SimpleConstructionScript)
-	//			{
-	//				bIsUneditableBlueprintComponent = true;
-	//				break;
-	//			}
-	//		}
-	//	}
-	//	else if (!Node->CanEditDefaults() && NotEditableSetByBlueprint(Node->GetComponentTemplate()))
-	//	{
-	//		bIsUneditableBlueprintComponent = true;
-	//		break;
-	//	}
-	//}
+	// A single pass over the selection; the archetype chain of each native component is walked at most once
+	for (const FSCSRuntimeEditorTreeNodePtrType& Node : SelectedNodes)
+	{
+		if (!Node.IsValid() || Node->GetNodeType() != FSCSRuntimeEditorTreeNode::ComponentNode)
+		{
+			continue;
+		}
 
-	//return bIsUneditableBlueprintComponent ? EVisibility::Visible : EVisibility::Collapsed;
+		UActorComponent* Component = Node->GetComponentTemplate();
+		if (Component == nullptr)
+		{
+			continue;
+		}
+
+		if (!Node->IsNative())
+		{
+			// Check to see if any selected components are created by the construction script or inherited from blueprint
+			if (Component->CreationMethod == EComponentCreationMethod::UserConstructionScript)
+			{
+				bIsUCSComponent = true;
+			}
+			else if (!Component->IsEditableWhenInherited() && Component->CreationMethod == EComponentCreationMethod::SimpleConstructionScript)
+			{
+				bIsUneditableBlueprintComponent = true;
+			}
+		}
+		else if (!Node->CanEditDefaults())
+		{
+			// Check to see if the component is native and not editable
+			if (NotEditableSetByBlueprint(Component))
+			{
+				bIsUneditableBlueprintComponent = true;
+			}
+			else
+			{
+				bIsUneditableNative = true;
+			}
+		}
+
+		if (bIsUCSComponent && bIsUneditableBlueprintComponent && bIsUneditableNative)
+		{
+			break;
+		}
+	}
+
+	UCSComponentWarning->SetVisibility(bIsUCSComponent ? EVisibility::Visible : EVisibility::Collapsed);
+	InheritedBlueprintComponentWarning->SetVisibility(bIsUneditableBlueprintComponent ? EVisibility::Visible : EVisibility::Collapsed);
+	NativeComponentWarning->SetVisibility(bIsUneditableNative ? EVisibility::Visible : EVisibility::Collapsed);
 }
 
-EVisibility SActorRuntimeDetails::GetNativeComponentWarningVisibility() const
+EVisibility SActorRuntimeDetails::GetWatchListVisibility() const
 {
-	return EVisibility::Collapsed;
-	
-	//bool bIsUneditableNative = false;
-	//for (const FSCSRuntimeEditorTreeNodePtrType& Node : SCSRuntimeEditor->GetSelectedNodes())
-	//{
-	//	// Check to see if the component is native and not editable
-	//	if (Node->IsNative() && !Node->CanEditDefaults() && !NotEditableSetByBlueprint(Node->GetComponentTemplate()))
-	//	{
-	//		bIsUneditableNative = true;
-	//		break;
-	//	}
-	//}
-	//
-	//return bIsUneditableNative ? EVisibility::Visible : EVisibility::Collapsed;
+	return WatchList->HasWatches() ? EVisibility::Visible : EVisibility::Collapsed;
 }
 
 void SActorRuntimeDetails::AddBPComponentCompileEventDelegate(UBlueprint* ComponentBlueprint)
@@ -857,7 +1457,5 @@ void SActorRuntimeDetails::OnBlueprintComponentCompiled(UBlueprint* ComponentBlu
 	if (GEditor->PlayWorld == nullptr)
 		return;
 
-	bSelectedComponentRecompiled = true;
-	UpdateComponentTreeFromEditorSelection();
-	bSelectedComponentRecompiled = false;
+	RequestRefresh(EActorRuntimeDetailsRefresh::TreeSelection | EActorRuntimeDetailsRefresh::ForceDetails);
 }
@@ -13,16 +13,42 @@
 
 
 class AActor;
+class FActiveTimerHandle;
+class FRuntimeActorSnapshot;
 class FSCSRuntimeEditorTreeNode;
 class FTabManager;
 class FUICommandList;
 class IDetailsView;
 class SBox;
+class SDockTab;
+class SRuntimePropertyWatchList;
 class SSCSRuntimeEditor;
 class SSplitter;
 class UBlueprint;
 
 
+/** Refresh work that SActorRuntimeDetails batches up and runs once per Slate tick */
+enum class EActorRuntimeDetailsRefresh : uint8
+{
+	None				= 0,
+	// Apply the objects passed to the last SetObjects() call
+	Objects				= 1 << 0,
+	// Reconcile the component tree with the Actor instance
+	Tree				= 1 << 1,
+	// Match the tree selection to the level editor component selection
+	TreeSelection		= 1 << 2,
+	// Refresh the selection flags of the selected Actors' components
+	SelectionFlags		= 1 << 3,
+	// Update the transform widget pivot for the selection
+	Pivot				= 1 << 4,
+	// Force the details view to rebuild even if the objects didn't change
+	ForceDetails		= 1 << 5,
+};
+ENUM_CLASS_FLAGS(EActorRuntimeDetailsRefresh);
+
+/** An editor selection, captured once and shared by every panel it is handed to */
+typedef TArray<TWeakObjectPtr<UObject>> FActorRuntimeDetailsSelection;
+
 /**
  * Wraps a details panel customized for viewing actors
  */
@@ -42,16 +68,86 @@ public:
 	 */
 	void SetObjects(const TArray<UObject*>& InObjects, bool bForceRefresh = false);
 
+	/**
+	 * Sets the objects to be viewed by the details panel from a shared selection snapshot. Panels whose tab is in the
+	 * background only hold on to the snapshot, and refresh once their tab is brought to the foreground.
+	 *
+	 * @param InSelection	The selection to view, as returned by MakeSelection()
+	 */
+	void SetSelection(const TSharedRef<const FActorRuntimeDetailsSelection>& InSelection, bool bForceRefresh = false);
+
+	/** @return A snapshot of the given objects that can be handed to several panels */
+	static TSharedRef<const FActorRuntimeDetailsSelection> MakeSelection(const TArray<UObject*>& InObjects);
+
 	/** FEditorUndoClient Interface */
 	virtual void PostUndo(bool bSuccess) override;
 	virtual void PostRedo(bool bSuccess) override;
 
+	/** @return The number of refreshes requested so far; requests made within the same frame are coalesced into one processed refresh */
+	uint32 GetNumRefreshRequests() const { return NumRefreshRequests; }
+
+	/** @return The number of refreshes actually processed so far */
+	uint32 GetNumProcessedRefreshes() const { return NumProcessedRefreshes; }
+
+	/**
+	 * Enables or disables live watch mode, in which the displayed objects are sampled at ActorRuntimeDetails.LiveWatchRate
+	 * and the details view is only rebuilt, with the next coalesced refresh, when a container size or object reference changed;
+	 * at most ActorRuntimeDetails.LiveWatchMaxRebuildRate times per second
+	 */
+	void SetLiveWatchEnabled(bool bInEnabled);
+
+	/** @return True if live watch mode is enabled */
+	bool IsLiveWatchEnabled() const { return bLiveWatchEnabled; }
+
+	/** Captures the edited state of the displayed Actor and its components, replacing any previous snapshot */
+	void CaptureSnapshot();
+
+	/**
+	 * Restores the displayed Actor's last snapshot in one batch
+	 *
+	 * @return The number of properties whose value was changed
+	 */
+	int32 RestoreSnapshot();
+
 public:
 	// FNotifyHook
 	void NotifyPreChange(UProperty* PropertyAboutToChange) override;
 	void NotifyPostChange(const FPropertyChangedEvent& PropertyChangedEvent, UProperty* PropertyThatChanged) override;
 	
 private:
+	/** What is sampled from a watched property */
+	enum class ELiveWatchValue : uint8
+	{
+		// The element count of an array, map or set
+		ArrayNum,
+		MapNum,
+		SetNum,
+		// The hash of an object, weak, lazy or soft reference
+		Hash,
+	};
+
+	/**
+	 * A property sampled by the live watch and the range of the snapshot buffer holding its last sampled value. Only what alters
+	 * the rows shown for the property is sampled (container element counts and object references); plain values are read live by
+	 * their rows on every paint already. Members of structs are sampled at the offset of the struct within the object.
+	 */
+	struct FLiveWatchProperty
+	{
+		UProperty* Property;
+		int32 ContainerOffset;
+		ELiveWatchValue Value;
+		int32 SnapshotOffset;
+		int32 SnapshotSize;
+	};
+
+	/** An object shown in the details view and the range of LiveWatchProperties sampled from it */
+	struct FLiveWatchObject
+	{
+		TWeakObjectPtr<UObject> Object;
+		int32 FirstProperty;
+		int32 NumProperties;
+	};
+
 	AActor* GetSelectedActorInEditor() const;
 	AActor* GetActorContext() const;
 	bool GetAllowComponentTreeEditing() const;
@@ -67,13 +163,45 @@ private:
 	bool IsPropertyReadOnly(const struct FPropertyAndParent& PropertyAndParent) const;
 	bool IsPropertyEditingEnabled() const;
 	
-	EVisibility GetPlayInGameTipVisibility() const;
-	EVisibility GetUCSComponentWarningVisibility() const;
-	EVisibility GetInheritedBlueprintComponentWarningVisibility() const;
-	EVisibility GetNativeComponentWarningVisibility() const;
+	/**
+	 * Shows the warnings that apply to the given component selection; done once per selection change rather than polled on every
+	 * paint. This panel edits any component of the instance, so the warnings only point out where an edit has to be made to last.
+	 */
+	void UpdateComponentWarnings(const TArray<TSharedPtr<class FSCSRuntimeEditorTreeNode> >& SelectedNodes);
+	/** Shows the play-in-game tip while no game is running; the end of play also drops the snapshot */
+	void OnPIEStarted(bool bIsSimulating);
+	void OnPIEEnded(bool bIsSimulating);
+	/** Drops the snapshot, whose values may have been captured through a class the compile replaced */
+	void OnAnyBlueprintCompiled();
+	EVisibility GetWatchListVisibility() const;
 	void OnBlueprintedComponentWarningHyperlinkClicked(const FSlateHyperlinkRun::FMetadata& Metadata);
 	void OnNativeComponentWarningHyperlinkClicked(const FSlateHyperlinkRun::FMetadata& Metadata);
 
+	/** Queues the given refresh work for the next Slate tick, merging it with any work that is already pending */
+	void RequestRefresh(EActorRuntimeDetailsRefresh InRefresh);
+	/** Active timer callback that runs all of the pending refresh work at once */
+	EActiveTimerReturnType ProcessPendingRefresh(double InCurrentTime, float InDeltaTime);
+	/** @return True if the tab hosting this panel is in the foreground, or if the panel isn't hosted in a tab */
+	bool IsInForegroundTab() const;
+	/** Runs the refresh work deferred while this panel's tab was in the background */
+	void OnTabForegrounded(TSharedPtr<SDockTab> NewForegroundTab, TSharedPtr<SDockTab> BackgroundedTab);
+
+	/** Registers the live watch timer with the currently configured sample period, replacing any previous one */
+	void RegisterLiveWatchTimer();
+	/** Active timer callback that samples the watched properties and refreshes the details view when they changed */
+	EActiveTimerReturnType SampleLiveWatch(double InCurrentTime, float InDeltaTime);
+	/** Rebuilds the list of watched properties and the snapshot buffer for the objects shown in the details view */
+	void RebuildLiveWatch(const TArray<TWeakObjectPtr<UObject>>& InObjects);
+	/** Adds the watched properties of a struct found at the given offset in the object, including those of the structs it contains */
+	void AddLiveWatchProperties(const UStruct* InStruct, int32 InContainerOffset, FLiveWatchObject& InOutWatchedObject);
+	/** Copies the current value of a watched property into its snapshot range, returning true if it differs from the previous sample */
+	static bool SampleLiveWatchProperty(const FLiveWatchProperty& InWatched, const UObject* InObject, uint8* InOutSnapshot);
+	ECheckBoxState GetLiveWatchCheckState() const;
+	void OnLiveWatchCheckStateChanged(ECheckBoxState InState);
+	FReply OnCaptureSnapshotClicked();
+	FReply OnRestoreSnapshotClicked();
+	bool IsRestoreSnapshotEnabled() const;
+
 	void AddBPComponentCompileEventDelegate(UBlueprint* ComponentBlueprint);
 	void RemoveBPComponentCompileEventDelegate();
 	void OnBlueprintComponentCompiled(UBlueprint* ComponentBlueprint);
@@ -84,6 +212,12 @@ private:
 	TSharedPtr<class IDetailsView> DetailsView;
 	TSharedPtr<SBox> ComponentsBox;
 	TSharedPtr<class SSCSRuntimeEditor> SCSRuntimeEditor;
+	TSharedPtr<SRuntimePropertyWatchList> WatchList;
+
+	// Warnings about the selected components, shown by UpdateComponentWarnings()
+	TSharedPtr<SWidget> UCSComponentWarning;
+	TSharedPtr<SWidget> InheritedBlueprintComponentWarning;
+	TSharedPtr<SWidget> NativeComponentWarning;
 
 	// The actor selected when the details panel was locked
 	TWeakObjectPtr<AActor> LockedActorSelection;
@@ -97,4 +231,41 @@ private:
 
 	// True if the actor "root" node in the SCS editor is currently shown as selected
 	bool bShowingRootActorNodeSelected;
+
+	// Refresh work requested since the last processed refresh
+	EActorRuntimeDetailsRefresh PendingRefresh;
+
+	// The selection passed to the last SetObjects() call, applied with the next processed refresh
+	TSharedPtr<const FActorRuntimeDetailsSelection> PendingSelection;
+
+	// True if the pending refresh waits for the hosting tab to be brought to the foreground
+	bool bRefreshDeferredUntilForeground;
+
+	// The tab hosting this panel, found on first use
+	mutable TWeakPtr<SDockTab> OwnerTab;
+
+	FDelegateHandle TabForegroundedHandle;
+
+	// Counters for requested and processed refreshes
+	uint32 NumRefreshRequests;
+	uint32 NumProcessedRefreshes;
+
+	// True if the displayed objects are sampled periodically while playing
+	bool bLiveWatchEnabled;
+
+	// The live watch timer and the period it was registered with
+	TSharedPtr<FActiveTimerHandle> LiveWatchTimerHandle;
+	float LiveWatchTimerPeriod;
+
+	// True if a sampled change still awaits a details view rebuild, and when the live watch last requested one
+	bool bLiveWatchRebuildPending;
+	double LastLiveWatchRebuildTime;
+
+	// The watched objects and properties, and the last sampled value of every watched property
+	TArray<FLiveWatchObject> LiveWatchObjects;
+	TArray<FLiveWatchProperty> LiveWatchProperties;
+	TArray<uint8> LiveWatchSnapshot;
+
+	// The edited state captured from the displayed Actor, to be restored on demand
+	TUniquePtr<FRuntimeActorSnapshot> ActorSnapshot;
 };
@@ -0,0 +1,312 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/DateTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Components/SceneComponent.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "PreviewScene.h"
+#include "SSCSRuntimeEditor.h"
+
+#if !UE_BUILD_SHIPPING
+
+DEFINE_LOG_CATEGORY_STATIC(LogSCSRuntimeEditorBenchmark, Log, All);
+
+/**
+ * Times the component tree operations of SSCSRuntimeEditor against synthetic Actors spawned in a preview world, counts the tree
+ * nodes they create and how many of those missed the node pool, and writes the results as CSV and JSON so that they can be compared from one build to the next.
+ *
+ * Runs as the ActorRuntimeDetails.Benchmark.ComponentTree automation test with the default sizes, or with other sizes through:
+ * ActorRuntimeDetails.Benchmark [Components=1000] [Depth=8] [Iterations=10] [Output=<path without extension>]
+ */
+class FSCSRuntimeEditorBenchmark
+{
+public:
+	struct FResult
+	{
+		FString Name;
+		double MinMs;
+		double MaxMs;
+		double TotalMs;
+		uint64 TotalNodesCreated;
+		uint64 TotalNodePoolMisses;
+	};
+
+	/** Up to this many components, rebuilding the tree takes every node from the pool and reconciling it creates none */
+	static const int32 ZeroAllocationNumComponents = 64;
+
+	FSCSRuntimeEditorBenchmark(int32 InNumComponents, int32 InAttachDepth, int32 InNumIterations)
+		: NumComponents(FMath::Max(InNumComponents, 1))
+		, AttachDepth(FMath::Clamp(InAttachDepth, 1, NumComponents))
+		, NumIterations(FMath::Max(InNumIterations, 1))
+		, NumMissingNodes(0)
+	{
+	}
+
+	/** Runs every benchmark and writes the results next to the given base path; returns false if a lookup missed a component */
+	bool Run(const FString& OutputBasePath, FOutputDevice& Ar)
+	{
+		FPreviewScene PreviewScene(FPreviewScene::ConstructionValues().SetTransactional(false));
+
+		TArray<UActorComponent*> Components;
+		AActor* Actor = SpawnSyntheticActor(PreviewScene.GetWorld(), Components);
+
+		TSharedPtr<SSCSRuntimeEditor> SCSRuntimeEditor;
+		Measure(TEXT("Construct"), [&]()
+		{
+			SCSRuntimeEditor = SNew(SSCSRuntimeEditor)
+				.EditorMode(EComponentEditorMode::ActorInstance)
+				.ActorContext(Actor)
+				.AllowEditing(false);
+		});
+
+		// A tree without an Actor node can't be reconciled, so every iteration takes the full rebuild path
+		Measure(TEXT("UpdateTree (rebuild)"), [&]()
+		{
+			SCSRuntimeEditor->RootNodes.Reset();
+			SCSRuntimeEditor->UpdateTree(/*bRegenerateTreeNodes =*/true);
+		});
+
+		Measure(TEXT("UpdateTree (reconcile)"), [&]()
+		{
+			SCSRuntimeEditor->UpdateTree(/*bRegenerateTreeNodes =*/true);
+		});
+
+		// Moves the last component back and forth between two parents, so that each reconcile has a node to reparent
+		USceneComponent* MovedComponent = CastChecked<USceneComponent>(Components.Last());
+		USceneComponent* OtherParents[] = { CastChecked<USceneComponent>(Components[0]), MovedComponent->GetAttachParent() };
+		int32 NumMoves = 0;
+		Measure(TEXT("UpdateTree (reconcile, reattach)"), [&]()
+		{
+			MovedComponent->AttachToComponent(OtherParents[NumMoves++ % 2], FAttachmentTransformRules::KeepRelativeTransform);
+			SCSRuntimeEditor->UpdateTree(/*bRegenerateTreeNodes =*/true);
+		});
+
+		// Lookups don't build the nodes of deferred components, so build them all first
+		for (UActorComponent* Component : Components)
+		{
+			SCSRuntimeEditor->MaterializeDeferredComponent(Component);
+		}
+
+		Measure(TEXT("FindTreeNode"), [&]()
+		{
+			for (UActorComponent* Component : Components)
+			{
+				if (!SCSRuntimeEditor->FindTreeNode(Component).IsValid())
+				{
+					++NumMissingNodes;
+				}
+			}
+		});
+
+		Measure(TEXT("GetNodeFromActorComponent"), [&]()
+		{
+			for (UActorComponent* Component : Components)
+			{
+				SCSRuntimeEditor->GetNodeFromActorComponent(Component);
+			}
+		});
+
+		// Types a component name one character at a time, then clears the filter, as a user would
+		const FString FilterString = Components.Last()->GetName();
+		Measure(TEXT("OnFilterTextChanged"), [&]()
+		{
+			for (int32 NumChars = 1; NumChars <= FilterString.Len(); ++NumChars)
+			{
+				SCSRuntimeEditor->OnFilterTextChanged(FText::FromString(FilterString.Left(NumChars)));
+			}
+			SCSRuntimeEditor->OnFilterTextChanged(FText::GetEmpty());
+		});
+
+		SCSRuntimeEditor.Reset();
+		Actor->Destroy();
+
+		WriteResults(OutputBasePath, Ar);
+
+		if (NumMissingNodes > 0)
+		{
+			Ar.Logf(ELogVerbosity::Error, TEXT("FindTreeNode didn't find a node for %d components"), NumMissingNodes);
+		}
+
+		return NumMissingNodes == 0;
+	}
+
+	/** @return The default base path of the result files, under the profiling directory */
+	static FString GetDefaultOutputBasePath()
+	{
+		return FPaths::Combine(FPaths::ProfilingDir(), TEXT("ActorRuntimeDetails"), FString::Printf(TEXT("Benchmark-%s"), *FDateTime::Now().ToString()));
+	}
+
+	/** @return The result of the operation with the given name, or null if Run() didn't measure it */
+	const FResult* FindResult(const TCHAR* Name) const
+	{
+		return Results.FindByPredicate([Name](const FResult& Result) { return Result.Name == Name; });
+	}
+
+private:
+	/** Spawns an Actor with NumComponents scene components, attached as a chain AttachDepth deep with the rest spread across it */
+	AActor* SpawnSyntheticActor(UWorld* World, TArray<UActorComponent*>& OutComponents) const
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.ObjectFlags = RF_Transient;
+		AActor* Actor = World->SpawnActor<AActor>(SpawnParams);
+
+		TArray<USceneComponent*> Chain;
+		Chain.Reserve(AttachDepth);
+		OutComponents.Reserve(NumComponents);
+		for (int32 ComponentIndex = 0; ComponentIndex < NumComponents; ++ComponentIndex)
+		{
+			USceneComponent* Component = NewObject<USceneComponent>(Actor, *FString::Printf(TEXT("BenchmarkComponent_%d"), ComponentIndex), RF_Transient);
+			Component->CreationMethod = EComponentCreationMethod::Instance;
+
+			if (ComponentIndex == 0)
+			{
+				Actor->SetRootComponent(Component);
+			}
+			else
+			{
+				USceneComponent* Parent = Chain.Num() < AttachDepth ? Chain.Last() : Chain[ComponentIndex % AttachDepth];
+				Component->SetupAttachment(Parent);
+			}
+
+			if (Chain.Num() < AttachDepth)
+			{
+				Chain.Add(Component);
+			}
+
+			Actor->AddInstanceComponent(Component);
+			Component->RegisterComponent();
+			OutComponents.Add(Component);
+		}
+
+		return Actor;
+	}
+
+	template<typename FunctorType>
+	void Measure(const TCHAR* Name, FunctorType&& Functor)
+	{
+		FResult& Result = Results[Results.AddDefaulted()];
+		Result.Name = Name;
+		Result.MinMs = TNumericLimits<double>::Max();
+		Result.MaxMs = 0.0;
+		Result.TotalMs = 0.0;
+		Result.TotalNodesCreated = 0;
+		Result.TotalNodePoolMisses = 0;
+
+		for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+		{
+			const uint64 NumNodesCreated = FSCSRuntimeEditorTreeNode::GetNumNodesCreated();
+			const uint64 NumNodePoolMisses = FSCSRuntimeEditorTreeNode::GetNumNodePoolMisses();
+			const double StartTime = FPlatformTime::Seconds();
+			Functor();
+			const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+			Result.TotalNodesCreated += FSCSRuntimeEditorTreeNode::GetNumNodesCreated() - NumNodesCreated;
+			Result.TotalNodePoolMisses += FSCSRuntimeEditorTreeNode::GetNumNodePoolMisses() - NumNodePoolMisses;
+
+			Result.MinMs = FMath::Min(Result.MinMs, ElapsedMs);
+			Result.MaxMs = FMath::Max(Result.MaxMs, ElapsedMs);
+			Result.TotalMs += ElapsedMs;
+		}
+	}
+
+	void WriteResults(const FString& OutputBasePath, FOutputDevice& Ar) const
+	{
+		FString Csv = TEXT("Operation,Components,Depth,Iterations,MinMs,AvgMs,MaxMs,AvgNodesCreated,AvgNodePoolMisses\n");
+		FString Json = TEXT("{\n\t\"results\": [\n");
+		for (int32 ResultIndex = 0; ResultIndex < Results.Num(); ++ResultIndex)
+		{
+			const FResult& Result = Results[ResultIndex];
+			const double AvgMs = Result.TotalMs / NumIterations;
+			const double AvgNodesCreated = (double)Result.TotalNodesCreated / NumIterations;
+			const double AvgNodePoolMisses = (double)Result.TotalNodePoolMisses / NumIterations;
+
+			Csv += FString::Printf(TEXT("%s,%d,%d,%d,%.4f,%.4f,%.4f,%.1f,%.1f\n"), *Result.Name, NumComponents, AttachDepth, NumIterations, Result.MinMs, AvgMs, Result.MaxMs, AvgNodesCreated, AvgNodePoolMisses);
+			Json += FString::Printf(TEXT("\t\t{ \"operation\": \"%s\", \"components\": %d, \"depth\": %d, \"iterations\": %d, \"minMs\": %.4f, \"avgMs\": %.4f, \"maxMs\": %.4f, \"avgNodesCreated\": %.1f, \"avgNodePoolMisses\": %.1f }%s\n"),
+				*Result.Name, NumComponents, AttachDepth, NumIterations, Result.MinMs, AvgMs, Result.MaxMs, AvgNodesCreated, AvgNodePoolMisses, ResultIndex < Results.Num() - 1 ? TEXT(",") : TEXT(""));
+
+			Ar.Logf(TEXT("%-34s min %9.4f ms  avg %9.4f ms  max %9.4f ms  avg %9.1f nodes created  avg %9.1f pool misses"), *Result.Name, Result.MinMs, AvgMs, Result.MaxMs, AvgNodesCreated, AvgNodePoolMisses);
+		}
+		Json += TEXT("\t]\n}\n");
+
+		const FString CsvPath = OutputBasePath + TEXT(".csv");
+		const FString JsonPath = OutputBasePath + TEXT(".json");
+		if (FFileHelper::SaveStringToFile(Csv, *CsvPath) && FFileHelper::SaveStringToFile(Json, *JsonPath))
+		{
+			Ar.Logf(TEXT("Benchmark results written to %s and %s"), *CsvPath, *JsonPath);
+		}
+		else
+		{
+			UE_LOG(LogSCSRuntimeEditorBenchmark, Warning, TEXT("Failed to write benchmark results to %s"), *OutputBasePath);
+		}
+	}
+
+	int32 NumComponents;
+	int32 AttachDepth;
+	int32 NumIterations;
+	int32 NumMissingNodes;
+	TArray<FResult> Results;
+};
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSCSRuntimeEditorBenchmarkTest, "ActorRuntimeDetails.Benchmark.ComponentTree", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+
+bool FSCSRuntimeEditorBenchmarkTest::RunTest(const FString& Parameters)
+{
+	const FString OutputBasePath = FSCSRuntimeEditorBenchmark::GetDefaultOutputBasePath();
+	bool bSucceeded = FSCSRuntimeEditorBenchmark(/*InNumComponents =*/1000, /*InAttachDepth =*/8, /*InNumIterations =*/10).Run(OutputBasePath, *GLog);
+	TestTrue(TEXT("Every component of the synthetic Actor has a tree node"), bSucceeded);
+	AddInfo(FString::Printf(TEXT("Benchmark results written to %s.csv and %s.json"), *OutputBasePath, *OutputBasePath));
+
+	// The nodes of the trees built by the constructs measured first are back in the pool by the time the tree is rebuilt
+	const FString SmallActorOutputBasePath = OutputBasePath + TEXT("-Small");
+	FSCSRuntimeEditorBenchmark SmallActorBenchmark(FSCSRuntimeEditorBenchmark::ZeroAllocationNumComponents, /*InAttachDepth =*/8, /*InNumIterations =*/10);
+	const bool bSmallActorSucceeded = SmallActorBenchmark.Run(SmallActorOutputBasePath, *GLog);
+	TestTrue(TEXT("Every component of the small synthetic Actor has a tree node"), bSmallActorSucceeded);
+
+	const FSCSRuntimeEditorBenchmark::FResult* RebuildResult = SmallActorBenchmark.FindResult(TEXT("UpdateTree (rebuild)"));
+	const FSCSRuntimeEditorBenchmark::FResult* ReconcileResult = SmallActorBenchmark.FindResult(TEXT("UpdateTree (reconcile)"));
+	if (TestNotNull(TEXT("The tree rebuild was measured"), RebuildResult) && TestNotNull(TEXT("The tree reconcile was measured"), ReconcileResult))
+	{
+		TestEqual(TEXT("Rebuilding the tree of a small Actor takes every node from the pool"), (int32)RebuildResult->TotalNodePoolMisses, 0);
+		TestEqual(TEXT("Reconciling the tree of a small Actor creates no nodes"), (int32)ReconcileResult->TotalNodesCreated, 0);
+		TestEqual(TEXT("Reconciling the tree of a small Actor takes every node from the pool"), (int32)ReconcileResult->TotalNodePoolMisses, 0);
+	}
+
+	return bSucceeded && bSmallActorSucceeded && !HasAnyErrors();
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
+
+static FAutoConsoleCommandWithWorldArgsAndOutputDevice SCSRuntimeEditorBenchmarkCommand(
+	TEXT("ActorRuntimeDetails.Benchmark"),
+	TEXT("Times the component tree operations against a synthetic Actor and writes the results as CSV and JSON.\n")
+	TEXT("Usage: ActorRuntimeDetails.Benchmark [Components=1000] [Depth=8] [Iterations=10] [Output=<path without extension>]"),
+	FConsoleCommandWithWorldArgsAndOutputDeviceDelegate::CreateLambda([](const TArray<FString>& Args, UWorld*, FOutputDevice& Ar)
+	{
+		const FString CommandLine = FString::Join(Args, TEXT(" "));
+
+		int32 NumComponents = 1000;
+		int32 AttachDepth = 8;
+		int32 NumIterations = 10;
+		FParse::Value(*CommandLine, TEXT("Components="), NumComponents);
+		FParse::Value(*CommandLine, TEXT("Depth="), AttachDepth);
+		FParse::Value(*CommandLine, TEXT("Iterations="), NumIterations);
+
+		FString OutputBasePath;
+		if (!FParse::Value(*CommandLine, TEXT("Output="), OutputBasePath))
+		{
+			OutputBasePath = FSCSRuntimeEditorBenchmark::GetDefaultOutputBasePath();
+		}
+
+		FSCSRuntimeEditorBenchmark(NumComponents, AttachDepth, NumIterations).Run(OutputBasePath, Ar);
+	}));
+
+#endif // !UE_BUILD_SHIPPING
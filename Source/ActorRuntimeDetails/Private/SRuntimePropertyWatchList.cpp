@@ -0,0 +1,345 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "SRuntimePropertyWatchList.h"
+#include "UObject/UnrealType.h"
+#include "Widgets/SBoxPanel.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Input/SButton.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SBox.h"
+#include "Rendering/DrawElements.h"
+#include "EditorStyleSet.h"
+#include "PropertyHandle.h"
+#include "ActorRuntimeDetailsStats.h"
+
+#define LOCTEXT_NAMESPACE "SRuntimePropertyWatchList"
+
+DECLARE_CYCLE_STAT(TEXT("Watch List Sample"), STAT_ActorRuntimeDetails_SampleWatches, STATGROUP_ActorRuntimeDetails);
+
+bool FRuntimePropertyWatch::Sample()
+{
+	const UObject* Owner = Object.Get();
+	if (Owner == nullptr)
+	{
+		return false;
+	}
+
+	const void* ValuePtr = reinterpret_cast<const uint8*>(Owner) + ValueOffset;
+
+	float Value;
+	if (BoolProperty)
+	{
+		Value = BoolProperty->GetPropertyValue(ValuePtr) ? 1.f : 0.f;
+	}
+	else if (NumericProperty->IsFloatingPoint())
+	{
+		Value = (float)NumericProperty->GetFloatingPointPropertyValue(ValuePtr);
+	}
+	else
+	{
+		Value = (float)NumericProperty->GetSignedIntPropertyValue(ValuePtr);
+	}
+
+	History[Head] = Value;
+	Head = (Head + 1) % HistorySize;
+	NumSamples = FMath::Min(NumSamples + 1, HistorySize);
+
+	return true;
+}
+
+void SRuntimePropertyWatchSparkline::Construct(const FArguments& InArgs, FRuntimePropertyWatchPtr InWatch)
+{
+	Watch = InWatch;
+	LinePoints.Reserve(FRuntimePropertyWatch::HistorySize);
+}
+
+int32 SRuntimePropertyWatchSparkline::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	TSharedPtr<FRuntimePropertyWatch> PinnedWatch = Watch.Pin();
+	if (!PinnedWatch.IsValid() || PinnedWatch->NumSamples < 2)
+	{
+		return LayerId;
+	}
+
+	const FRuntimePropertyWatch& WatchRef = *PinnedWatch;
+	const int32 FirstSample = (WatchRef.Head + FRuntimePropertyWatch::HistorySize - WatchRef.NumSamples) % FRuntimePropertyWatch::HistorySize;
+
+	float MinValue = MAX_flt;
+	float MaxValue = -MAX_flt;
+	for (int32 SampleIndex = 0; SampleIndex < WatchRef.NumSamples; ++SampleIndex)
+	{
+		const float Value = WatchRef.History[(FirstSample + SampleIndex) % FRuntimePropertyWatch::HistorySize];
+		MinValue = FMath::Min(MinValue, Value);
+		MaxValue = FMath::Max(MaxValue, Value);
+	}
+
+	// A constant value is drawn as a flat line through the middle
+	const FVector2D Size = AllottedGeometry.GetLocalSize();
+	const float Range = MaxValue - MinValue;
+	const float XStep = Size.X / (FRuntimePropertyWatch::HistorySize - 1);
+	const float XStart = Size.X - XStep * (WatchRef.NumSamples - 1);
+
+	LinePoints.Reset();
+	for (int32 SampleIndex = 0; SampleIndex < WatchRef.NumSamples; ++SampleIndex)
+	{
+		const float Value = WatchRef.History[(FirstSample + SampleIndex) % FRuntimePropertyWatch::HistorySize];
+		const float Alpha = Range > KINDA_SMALL_NUMBER ? (Value - MinValue) / Range : 0.5f;
+		LinePoints.Add(FVector2D(XStart + XStep * SampleIndex, (1.f - Alpha) * (Size.Y - 1.f)));
+	}
+
+	FSlateDrawElement::MakeLines(
+		OutDrawElements,
+		LayerId,
+		AllottedGeometry.ToPaintGeometry(),
+		LinePoints,
+		ShouldBeEnabled(bParentEnabled) ? ESlateDrawEffect::None : ESlateDrawEffect::DisabledEffect,
+		InWidgetStyle.GetColorAndOpacityTint() * FLinearColor(0.3f, 0.8f, 1.f),
+		true);
+
+	return LayerId;
+}
+
+FVector2D SRuntimePropertyWatchSparkline::ComputeDesiredSize(float) const
+{
+	return FVector2D(FRuntimePropertyWatch::HistorySize, 16.f);
+}
+
+void SRuntimePropertyWatchList::Construct(const FArguments& InArgs)
+{
+	bSampling = false;
+
+	ChildSlot
+	[
+		SAssignNew(ListView, SListView<FRuntimePropertyWatchPtr>)
+		.ListItemsSource(&Watches)
+		.SelectionMode(ESelectionMode::None)
+		.OnGenerateRow(this, &SRuntimePropertyWatchList::OnGenerateRow)
+	];
+}
+
+bool SRuntimePropertyWatchList::CanWatch(const IPropertyHandle& PropertyHandle, int32* OutValueOffset)
+{
+	UProperty* Property = PropertyHandle.GetProperty();
+	if (Property == nullptr || !( Property->IsA<UNumericProperty>() || Property->IsA<UBoolProperty>() ))
+	{
+		return false;
+	}
+
+	// Accumulate the offset of the value while walking up to the object; anything other than a struct in between (containers, subobjects) isn't sampled
+	int32 ValueOffset = 0;
+	TSharedPtr<IPropertyHandle> CurrentHandle;
+	const IPropertyHandle* Handle = &PropertyHandle;
+	for (;;)
+	{
+		const UProperty* HandleProperty = Handle->GetProperty();
+		ValueOffset += HandleProperty->GetOffset_ForInternal() + FMath::Max(Handle->GetIndexInArray(), 0) * HandleProperty->ElementSize;
+
+		// Static array elements have a parent for the array itself, which shares their property
+		TSharedPtr<IPropertyHandle> ParentHandle = Handle->GetParentHandle();
+		while (ParentHandle.IsValid() && ParentHandle->GetProperty() == HandleProperty)
+		{
+			ParentHandle = ParentHandle->GetParentHandle();
+		}
+
+		if (!ParentHandle.IsValid() || ParentHandle->GetProperty() == nullptr)
+		{
+			break;
+		}
+
+		if (!ParentHandle->GetProperty()->IsA<UStructProperty>())
+		{
+			return false;
+		}
+
+		CurrentHandle = ParentHandle;
+		Handle = CurrentHandle.Get();
+	}
+
+	if (OutValueOffset)
+	{
+		*OutValueOffset = ValueOffset;
+	}
+
+	return true;
+}
+
+void SRuntimePropertyWatchList::AddWatch(TSharedPtr<IPropertyHandle> PropertyHandle)
+{
+	int32 ValueOffset = 0;
+	if (!PropertyHandle.IsValid() || !CanWatch(*PropertyHandle, &ValueOffset))
+	{
+		return;
+	}
+
+	UProperty* Property = PropertyHandle->GetProperty();
+	const FString PropertyPath = PropertyHandle->GeneratePathToProperty();
+
+	TArray<UObject*> OuterObjects;
+	PropertyHandle->GetOuterObjects(OuterObjects);
+
+	for (UObject* Object : OuterObjects)
+	{
+		if (Object == nullptr)
+		{
+			continue;
+		}
+
+		const bool bAlreadyWatched = Watches.ContainsByPredicate([Object, Property, ValueOffset](const FRuntimePropertyWatchPtr& Watch)
+		{
+			return Watch->Object.Get() == Object && Watch->ValueOffset == ValueOffset && ( Watch->NumericProperty == Property || Watch->BoolProperty == Property );
+		});
+
+		if (!bAlreadyWatched)
+		{
+			FRuntimePropertyWatchPtr Watch = MakeShareable(new FRuntimePropertyWatch());
+			Watch->Object = Object;
+			Watch->NumericProperty = Cast<UNumericProperty>(Property);
+			Watch->BoolProperty = Cast<UBoolProperty>(Property);
+			Watch->ValueOffset = ValueOffset;
+			Watch->DisplayName = FText::FromString(FString::Printf(TEXT("%s.%s"), *Object->GetName(), *PropertyPath));
+			Watch->Sample();
+
+			Watches.Add(Watch);
+		}
+	}
+
+	ListView->RequestListRefresh();
+
+	if (!bSampling && Watches.Num() > 0)
+	{
+		bSampling = true;
+		RegisterActiveTimer(0.f, FWidgetActiveTimerDelegate::CreateSP(this, &SRuntimePropertyWatchList::SampleWatches));
+	}
+}
+
+void SRuntimePropertyWatchList::RemoveWatch(FRuntimePropertyWatchPtr InWatch)
+{
+	if (Watches.Remove(InWatch) > 0)
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+FReply SRuntimePropertyWatchList::OnRemoveWatchClicked(FRuntimePropertyWatchPtr InWatch)
+{
+	RemoveWatch(InWatch);
+	return FReply::Handled();
+}
+
+EActiveTimerReturnType SRuntimePropertyWatchList::SampleWatches(double InCurrentTime, float InDeltaTime)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_ActorRuntimeDetails_SampleWatches);
+
+	// Watches of objects that have been destroyed (e.g. when PIE ends) are dropped
+	bool bRemovedWatch = false;
+	for (int32 WatchIndex = Watches.Num() - 1; WatchIndex >= 0; --WatchIndex)
+	{
+		if (!Watches[WatchIndex]->Sample())
+		{
+			Watches.RemoveAt(WatchIndex);
+			bRemovedWatch = true;
+		}
+	}
+
+	if (bRemovedWatch)
+	{
+		ListView->RequestListRefresh();
+	}
+
+	if (Watches.Num() == 0)
+	{
+		bSampling = false;
+		return EActiveTimerReturnType::Stop;
+	}
+
+	return EActiveTimerReturnType::Continue;
+}
+
+static FText GetWatchValueText(TWeakPtr<FRuntimePropertyWatch> WeakWatch)
+{
+	static const FNumberFormattingOptions FormattingOptions = FNumberFormattingOptions().SetMaximumFractionalDigits(3);
+
+	TSharedPtr<FRuntimePropertyWatch> Watch = WeakWatch.Pin();
+	return Watch.IsValid() ? FText::AsNumber(Watch->GetLatest(), &FormattingOptions) : FText::GetEmpty();
+}
+
+TSharedRef<ITableRow> SRuntimePropertyWatchList::OnGenerateRow(FRuntimePropertyWatchPtr InWatch, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(STableRow<FRuntimePropertyWatchPtr>, OwnerTable)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.f)
+			.VAlign(VAlign_Center)
+			.Padding(2.f, 0.f)
+			[
+				SNew(STextBlock)
+				.Text(InWatch->DisplayName)
+				.ToolTipText(InWatch->DisplayName)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(2.f, 0.f)
+			[
+				SNew(SBox)
+				.MinDesiredWidth(64.f)
+				[
+					SNew(STextBlock)
+					.Text(TAttribute<FText>::Create(TAttribute<FText>::FGetter::CreateStatic(&GetWatchValueText, TWeakPtr<FRuntimePropertyWatch>(InWatch))))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(2.f, 1.f)
+			[
+				SNew(SRuntimePropertyWatchSparkline, InWatch)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(SButton)
+				.ButtonStyle(FEditorStyle::Get(), "NoBorder")
+				.ToolTipText(LOCTEXT("RemoveWatchTooltip", "Stop watching this value"))
+				.OnClicked(this, &SRuntimePropertyWatchList::OnRemoveWatchClicked, InWatch)
+				[
+					SNew(SImage)
+					.Image(FEditorStyle::GetBrush("PropertyWindow.Button_Clear"))
+				]
+			]
+		];
+}
+
+bool FRuntimePropertyWatchExtensionHandler::IsPropertyExtendable(const UClass* InObjectClass, const IPropertyHandle& PropertyHandle) const
+{
+	return WatchList.IsValid() && SRuntimePropertyWatchList::CanWatch(PropertyHandle);
+}
+
+TSharedRef<SWidget> FRuntimePropertyWatchExtensionHandler::GenerateExtensionWidget(const UClass* InObjectClass, TSharedPtr<IPropertyHandle> PropertyHandle)
+{
+	TWeakPtr<SRuntimePropertyWatchList> WeakWatchList = WatchList;
+
+	return SNew(SButton)
+		.ButtonStyle(FEditorStyle::Get(), "HoverHintOnly")
+		.ContentPadding(0.f)
+		.VAlign(VAlign_Center)
+		.ToolTipText(LOCTEXT("AddWatchTooltip", "Pin this value to the watch list and plot its history"))
+		.OnClicked(FOnClicked::CreateLambda([WeakWatchList, PropertyHandle]()
+		{
+			TSharedPtr<SRuntimePropertyWatchList> PinnedWatchList = WeakWatchList.Pin();
+			if (PinnedWatchList.IsValid())
+			{
+				PinnedWatchList->AddWatch(PropertyHandle);
+			}
+			return FReply::Handled();
+		}))
+		[
+			SNew(STextBlock)
+			.Font(FEditorStyle::GetFontStyle("PropertyWindow.NormalFont"))
+			.Text(LOCTEXT("AddWatch", "Watch"))
+		];
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,154 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/DeclarativeSyntaxSupport.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/SLeafWidget.h"
+#include "Widgets/Views/STableViewBase.h"
+#include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/SListView.h"
+#include "IDetailPropertyExtensionHandler.h"
+
+class IPropertyHandle;
+class SRuntimePropertyWatchList;
+class UBoolProperty;
+class UNumericProperty;
+
+/**
+ * A property pinned to the watch list, along with a fixed-size history of its sampled values.
+ * Sampling writes into the ring buffer in place and never allocates.
+ */
+struct FRuntimePropertyWatch
+{
+	/** Number of samples kept for the sparkline */
+	static const int32 HistorySize = 128;
+
+	/** The object that owns the watched value */
+	TWeakObjectPtr<UObject> Object;
+
+	/** The watched leaf property; exactly one of these is set */
+	UNumericProperty* NumericProperty;
+	UBoolProperty* BoolProperty;
+
+	/** Offset of the watched value from the start of the object, through any containing structs */
+	int32 ValueOffset;
+
+	/** Name displayed for the watch, e.g. "Pawn_0.Velocity.X" */
+	FText DisplayName;
+
+	/** Ring buffer of sampled values; Head is the slot the next sample is written to */
+	float History[HistorySize];
+	int32 Head;
+	int32 NumSamples;
+
+	FRuntimePropertyWatch()
+		: NumericProperty(nullptr)
+		, BoolProperty(nullptr)
+		, ValueOffset(0)
+		, Head(0)
+		, NumSamples(0)
+	{
+	}
+
+	/** Reads the current value of the watched property and appends it to the history; returns false if the object is gone */
+	bool Sample();
+
+	/** @return The most recently sampled value */
+	float GetLatest() const
+	{
+		return NumSamples > 0 ? History[(Head + HistorySize - 1) % HistorySize] : 0.f;
+	}
+};
+
+using FRuntimePropertyWatchPtr = TSharedPtr<FRuntimePropertyWatch>;
+
+/**
+ * Draws the sampled history of a watch as a line scaled to the range of the samples
+ */
+class SRuntimePropertyWatchSparkline : public SLeafWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SRuntimePropertyWatchSparkline) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, FRuntimePropertyWatchPtr InWatch);
+
+	// SWidget interface
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+	virtual FVector2D ComputeDesiredSize(float) const override;
+
+private:
+	TWeakPtr<FRuntimePropertyWatch> Watch;
+
+	// Reused between paints so drawing the line doesn't allocate once it has been sized
+	mutable TArray<FVector2D> LinePoints;
+};
+
+/**
+ * Compact list of properties pinned from the runtime details view, sampled every frame while playing
+ */
+class SRuntimePropertyWatchList : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SRuntimePropertyWatchList) {}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	/**
+	 * Pins the property represented by the given handle, once for each object it is shown for
+	 *
+	 * @param PropertyHandle	Handle of a property for which CanWatch() returned true
+	 */
+	void AddWatch(TSharedPtr<IPropertyHandle> PropertyHandle);
+
+	/** Unpins the given watch */
+	void RemoveWatch(FRuntimePropertyWatchPtr InWatch);
+
+	/** @return True if any property is pinned */
+	bool HasWatches() const { return Watches.Num() > 0; }
+
+	/**
+	 * @param PropertyHandle	The handle to test
+	 * @param OutValueOffset	If not null, receives the offset of the value from the start of the outer object
+	 * @return True if the handle is a numeric or bool value reachable from its object through structs only, so it can be sampled without the handle
+	 */
+	static bool CanWatch(const IPropertyHandle& PropertyHandle, int32* OutValueOffset = nullptr);
+
+private:
+	FReply OnRemoveWatchClicked(FRuntimePropertyWatchPtr InWatch);
+
+	TSharedRef<ITableRow> OnGenerateRow(FRuntimePropertyWatchPtr InWatch, const TSharedRef<STableViewBase>& OwnerTable);
+
+	/** Active timer callback that samples every watch */
+	EActiveTimerReturnType SampleWatches(double InCurrentTime, float InDeltaTime);
+
+private:
+	TSharedPtr<SListView<FRuntimePropertyWatchPtr>> ListView;
+
+	TArray<FRuntimePropertyWatchPtr> Watches;
+
+	// True while the sample timer is registered
+	bool bSampling;
+};
+
+/**
+ * Adds a pin button to the rows of the details view that can be watched
+ */
+class FRuntimePropertyWatchExtensionHandler : public IDetailPropertyExtensionHandler
+{
+public:
+	FRuntimePropertyWatchExtensionHandler(TSharedRef<SRuntimePropertyWatchList> InWatchList)
+		: WatchList(InWatchList)
+	{
+	}
+
+	// IDetailPropertyExtensionHandler interface
+	virtual bool IsPropertyExtendable(const UClass* InObjectClass, const IPropertyHandle& PropertyHandle) const override;
+	virtual TSharedRef<SWidget> GenerateExtensionWidget(const UClass* InObjectClass, TSharedPtr<IPropertyHandle> PropertyHandle) override;
+
+private:
+	TWeakPtr<SRuntimePropertyWatchList> WatchList;
+};
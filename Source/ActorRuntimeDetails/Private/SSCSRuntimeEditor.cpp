@@ -7,6 +7,7 @@
 #include "Framework/MultiBox/MultiBoxBuilder.h"
 #include "Components/PrimitiveComponent.h"
 #include "EngineGlobals.h"
+#include "EngineUtils.h"
 #include "Misc/FeedbackContext.h"
 #include "Serialization/ObjectWriter.h"
 #include "Serialization/ObjectReader.h"
@@ -17,6 +18,7 @@
 #include "Widgets/Layout/SSpacer.h"
 #include "Widgets/Images/SImage.h"
 #include "Widgets/Input/SButton.h"
+#include "Widgets/Input/SCheckBox.h"
 #include "EditorStyleSet.h"
 #include "Editor/UnrealEdEngine.h"
 #include "ThumbnailRendering/ThumbnailManager.h"
@@ -71,6 +73,8 @@
 #include "Algo/Find.h"
 #include "ActorEditorUtils.h"
 #include "RuntimeDetailsEditorUtils.h"
+#include "ActorRuntimeDetailsStats.h"
+#include "HAL/IConsoleManager.h"
 
 #if UE_4_24_OR_LATER
 #include "ToolMenus.h"
@@ -81,6 +85,39 @@
 
 DEFINE_LOG_CATEGORY_STATIC(LogSCSRuntimeEditor, Log, All);
 
+static TAutoConsoleVariable<int32> CVarTreeNodeBudget(
+	TEXT("ActorRuntimeDetails.TreeNodeBudget"),
+	256,
+	TEXT("Number of attached component nodes built up front when the component tree of an Actor instance is regenerated.\n")
+	TEXT("Nodes below that are only built once their parent is expanded. 0 builds the whole tree."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarRowRevalidateInterval(
+	TEXT("ActorRuntimeDetails.RowRevalidateInterval"),
+	0.25f,
+	TEXT("Seconds between checks of whether the name, asset or mobility shown by a component row changed, e.g. through gameplay code.\n")
+	TEXT("Only the rows the tree has generated are checked. 0 checks them on every tick."),
+	ECVF_Default);
+
+DECLARE_CYCLE_STAT(TEXT("SCS UpdateTree"), STAT_SCSRuntimeEditor_UpdateTree, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS Reconcile Tree"), STAT_SCSRuntimeEditor_ReconcileTree, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS Rebuild Node Index"), STAT_SCSRuntimeEditor_RebuildNodeIndex, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS OnFilterTextChanged"), STAT_SCSRuntimeEditor_OnFilterTextChanged, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS RefreshFilteredState"), STAT_SCSRuntimeEditor_RefreshFilteredState, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS IsComponentSelected"), STAT_SCSRuntimeEditor_IsComponentSelected, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS UpdateBaselineDiff"), STAT_SCSRuntimeEditor_UpdateBaselineDiff, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS CaptureBaselines"), STAT_SCSRuntimeEditor_CaptureBaselines, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS UpdateSelectionFromNodes"), STAT_SCSRuntimeEditor_UpdateSelectionFromNodes, STATGROUP_ActorRuntimeDetails);
+DECLARE_CYCLE_STAT(TEXT("SCS DeferChildActorTree"), STAT_SCSRuntimeEditor_DeferChildActorTree, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tree Rebuilds"), STAT_SCSRuntimeEditor_TreeRebuilds, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tree Reconciles"), STAT_SCSRuntimeEditor_TreeReconciles, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Row View Model Builds"), STAT_SCSRuntimeEditor_RowViewModelBuilds, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Shared Tree Model Hits"), STAT_SCSRuntimeEditor_SharedTreeModelHits, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tree Nodes Created"), STAT_SCSRuntimeEditor_NodeAllocations, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Tree Node Pool Misses"), STAT_SCSRuntimeEditor_NodePoolMisses, STATGROUP_ActorRuntimeDetails);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Live Tree Nodes"), STAT_SCSRuntimeEditor_LiveNodes, STATGROUP_ActorRuntimeDetails);
+DECLARE_MEMORY_STAT(TEXT("Tree Node Pool Memory"), STAT_SCSRuntimeEditor_NodePoolMemory, STATGROUP_ActorRuntimeDetails);
+
 static const FName SCS_ColumnName_ComponentClass( "ComponentClass" );
 static const FName SCS_ColumnName_Asset( "Asset" );
 static const FName SCS_ColumnName_Mobility( "Mobility" );
@@ -397,10 +434,169 @@ FReply FSCSRuntimeRowDragDropOp::DroppedOnPanel(const TSharedRef< class SWidget
 //////////////////////////////////////////////////////////////////////////
 // FSCSRuntimeEditorTreeNode
 
+
+/**
+ * Size-bucketed free lists for tree nodes. Freed nodes are kept for reuse rather than returned to the allocator, so a tree
+ * regenerated with a similar shape allocates no new memory. The pool holds at most the pages needed for the most nodes alive at
+ * once, and returns them all to the allocator as soon as no node is alive, i.e. once every component tree has been closed.
+ */
+class FSCSRuntimeEditorTreeNodePool
+{
+public:
+	static FSCSRuntimeEditorTreeNodePool& Get()
+	{
+		static FSCSRuntimeEditorTreeNodePool Pool;
+		return Pool;
+	}
+
+	void* Allocate(SIZE_T Size)
+	{
+		check(IsInGameThread());
+		INC_DWORD_STAT(STAT_SCSRuntimeEditor_NodeAllocations);
+		INC_DWORD_STAT(STAT_SCSRuntimeEditor_LiveNodes);
+		++NumAllocations;
+		++NumLiveNodes;
+
+		const int32 BucketIndex = GetBucketIndex(Size);
+		if (BucketIndex == INDEX_NONE)
+		{
+			INC_DWORD_STAT(STAT_SCSRuntimeEditor_NodePoolMisses);
+			++NumMisses;
+			return FMemory::Malloc(Size, Alignment);
+		}
+
+		if (FreeLists[BucketIndex] == nullptr)
+		{
+			INC_DWORD_STAT(STAT_SCSRuntimeEditor_NodePoolMisses);
+			++NumMisses;
+
+			// Carve a new page into free blocks of this bucket's size
+			const SIZE_T BlockSize = (BucketIndex + 1) * Alignment;
+			uint8* Page = (uint8*)FMemory::Malloc(BlockSize * BlocksPerPage, Alignment);
+			INC_MEMORY_STAT_BY(STAT_SCSRuntimeEditor_NodePoolMemory, BlockSize * BlocksPerPage);
+			Pages.Add(FPage{ Page, BlockSize * BlocksPerPage });
+			for (int32 BlockIndex = BlocksPerPage - 1; BlockIndex >= 0; --BlockIndex)
+			{
+				FFreeBlock* Block = (FFreeBlock*)(Page + BlockIndex * BlockSize);
+				Block->Next = FreeLists[BucketIndex];
+				FreeLists[BucketIndex] = Block;
+			}
+		}
+
+		FFreeBlock* Block = FreeLists[BucketIndex];
+		FreeLists[BucketIndex] = Block->Next;
+		return Block;
+	}
+
+	void Free(void* Ptr, SIZE_T Size)
+	{
+		check(IsInGameThread() && NumLiveNodes > 0);
+		DEC_DWORD_STAT(STAT_SCSRuntimeEditor_LiveNodes);
+		--NumLiveNodes;
+
+		const int32 BucketIndex = GetBucketIndex(Size);
+		if (BucketIndex == INDEX_NONE)
+		{
+			FMemory::Free(Ptr);
+		}
+		else
+		{
+			FFreeBlock* Block = (FFreeBlock*)Ptr;
+			Block->Next = FreeLists[BucketIndex];
+			FreeLists[BucketIndex] = Block;
+		}
+
+		if (NumLiveNodes == 0)
+		{
+			ReleasePages();
+		}
+	}
+
+	uint64 GetNumAllocations() const { return NumAllocations; }
+	uint64 GetNumMisses() const { return NumMisses; }
+
+private:
+	static const SIZE_T Alignment = 16;
+	static const int32 NumBuckets = 32;
+	static const int32 BlocksPerPage = 64;
+
+	struct FFreeBlock
+	{
+		FFreeBlock* Next;
+	};
+
+	struct FPage
+	{
+		uint8* Memory;
+		SIZE_T Size;
+	};
+
+	FSCSRuntimeEditorTreeNodePool()
+		: NumLiveNodes(0)
+		, NumAllocations(0)
+		, NumMisses(0)
+	{
+		FMemory::Memzero(FreeLists);
+	}
+
+	/** Returns every page to the allocator; only called once no node is alive, so every block is on a free list */
+	void ReleasePages()
+	{
+		for (const FPage& Page : Pages)
+		{
+			FMemory::Free(Page.Memory);
+			DEC_MEMORY_STAT_BY(STAT_SCSRuntimeEditor_NodePoolMemory, Page.Size);
+		}
+		Pages.Empty();
+		FMemory::Memzero(FreeLists);
+	}
+
+	static int32 GetBucketIndex(SIZE_T Size)
+	{
+		const SIZE_T BucketIndex = (Size + Alignment - 1) / Alignment - 1;
+		return BucketIndex < NumBuckets ? (int32)BucketIndex : INDEX_NONE;
+	}
+
+	// Pages aren't released on destruction, since nodes may still be alive during static destruction
+	FFreeBlock* FreeLists[NumBuckets];
+	TArray<FPage> Pages;
+	int32 NumLiveNodes;
+
+	// Kept alongside the stats so that they can be read without stats enabled
+	uint64 NumAllocations;
+	uint64 NumMisses;
+};
+
+void* FSCSRuntimeEditorTreeNode::operator new(size_t Size)
+{
+	return FSCSRuntimeEditorTreeNodePool::Get().Allocate(Size);
+}
+
+void FSCSRuntimeEditorTreeNode::operator delete(void* Ptr, size_t Size)
+{
+	if (Ptr != nullptr)
+	{
+		FSCSRuntimeEditorTreeNodePool::Get().Free(Ptr, Size);
+	}
+}
+
+uint64 FSCSRuntimeEditorTreeNode::GetNumNodesCreated()
+{
+	return FSCSRuntimeEditorTreeNodePool::Get().GetNumAllocations();
+}
+
+uint64 FSCSRuntimeEditorTreeNode::GetNumNodePoolMisses()
+{
+	return FSCSRuntimeEditorTreeNodePool::Get().GetNumMisses();
+}
+
 FSCSRuntimeEditorTreeNode::FSCSRuntimeEditorTreeNode(FSCSRuntimeEditorTreeNode::ENodeType InNodeType)
 	: ComponentTemplatePtr(nullptr)
 	, NodeType(InNodeType)
 	, FilterFlags((uint8)EFilteredState::Unknown)
+	, StructureGeneration(0)
+	, bFilterKeyValid(false)
+	, bRowViewModelValid(false)
 {
 }
 
@@ -428,6 +624,43 @@ FString FSCSRuntimeEditorTreeNode::GetDisplayString() const
 	return TEXT("GetDisplayString not overridden");
 }
 
+const FString& FSCSRuntimeEditorTreeNode::GetFilterKey() const
+{
+	if (!bFilterKeyValid)
+	{
+		FilterKey = GetDisplayString().ToLower();
+		bFilterKeyValid = true;
+	}
+
+	return FilterKey;
+}
+
+const FSCSRuntimeEditorRowViewModel& FSCSRuntimeEditorTreeNode::GetRowViewModel() const
+{
+	if (!RowViewModel.IsValid())
+	{
+		RowViewModel = MakeUnique<FSCSRuntimeEditorRowViewModel>();
+	}
+
+	if (!bRowViewModelValid)
+	{
+		INC_DWORD_STAT(STAT_SCSRuntimeEditor_RowViewModelBuilds);
+		SSCS_RuntimeRowWidget::BuildRowViewModel(*this, *RowViewModel);
+		bRowViewModelValid = true;
+	}
+
+	return *RowViewModel;
+}
+
+void FSCSRuntimeEditorTreeNode::RevalidateRowViewModel()
+{
+	// A view model that isn't built (or is already stale) is rebuilt from scratch the next time the row is painted anyway
+	if (bRowViewModelValid && !SSCS_RuntimeRowWidget::IsRowViewModelCurrent(*this, *RowViewModel))
+	{
+		bRowViewModelValid = false;
+	}
+}
+
 FText FSCSRuntimeEditorTreeNode::GetDisplayName() const
 {
 	return LOCTEXT("GetDisplayNameNotOverridden", "GetDisplayName not overridden");
@@ -483,6 +716,7 @@ UActorComponent* FSCSRuntimeEditorTreeNode::GetComponentTemplate(bool bEvenIfPen
 void FSCSRuntimeEditorTreeNode::SetComponentTemplate(UActorComponent* Component)
 {
 	ComponentTemplatePtr = Component;
+	InvalidateRowViewModel();
 }
 
 bool FSCSRuntimeEditorTreeNode::IsAttachedTo(FSCSRuntimeEditorTreeNodePtrType InNodePtr) const
@@ -639,6 +873,7 @@ void FSCSRuntimeEditorTreeNode::AddChild(FSCSRuntimeEditorTreeNodePtrType InChil
 	// Add the given node as a child and link its parent
 	Children.AddUnique(InChildNodePtr);
 	InChildNodePtr->ParentNodePtr = AsShared();
+	MarkStructureChanged();
 
 	if (InChildNodePtr->FilterFlags != EFilteredState::Unknown && !InChildNodePtr->IsFlaggedForFiltration())
 	{
@@ -903,6 +1138,7 @@ void FSCSRuntimeEditorTreeNode::RemoveChild(FSCSRuntimeEditorTreeNodePtrType InC
 	Children.Remove(InChildNodePtr);
 	InChildNodePtr->ParentNodePtr.Reset();
 	InChildNodePtr->RemoveMeAsChild();
+	MarkStructureChanged();
 
 	if (InChildNodePtr->IsFlaggedForFiltration())
 	{
@@ -910,6 +1146,30 @@ void FSCSRuntimeEditorTreeNode::RemoveChild(FSCSRuntimeEditorTreeNodePtrType InC
 	}
 }
 
+void FSCSRuntimeEditorTreeNode::UnlinkChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr)
+{
+	// Unlike RemoveChild(), this only updates the tree links; the SCS node and the component attachment are left as-is
+	Children.Remove(InChildNodePtr);
+	InChildNodePtr->ParentNodePtr.Reset();
+	MarkStructureChanged();
+
+	if (FilterFlags != EFilteredState::Unknown)
+	{
+		RefreshCachedChildFilterState(/*bUpdateParent =*/true);
+	}
+}
+
+void FSCSRuntimeEditorTreeNode::MarkStructureChanged()
+{
+	FSCSRuntimeEditorTreeNode* RootNode = this;
+	while (RootNode->ParentNodePtr.IsValid())
+	{
+		RootNode = RootNode->ParentNodePtr.Get();
+	}
+
+	++RootNode->StructureGeneration;
+}
+
 void FSCSRuntimeEditorTreeNode::OnRequestRename(TUniquePtr<FScopedTransaction> InOngoingCreateTransaction)
 {
 	OngoingCreateTransaction = MoveTemp(InOngoingCreateTransaction); // Take responsibility to end the 'create + give initial name' transaction.
@@ -1445,6 +1705,24 @@ void FSCSRuntimeEditorTreeNodeRootActor::RemoveChild(FSCSRuntimeEditorTreeNodePt
 {
 	Super::RemoveChild(InChildNodePtr);
 
+	RemoveUnusedSeparators();
+}
+
+void FSCSRuntimeEditorTreeNodeRootActor::UnlinkChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr)
+{
+	Super::UnlinkChild(InChildNodePtr);
+
+	ComponentNodes.Remove(InChildNodePtr);
+	if (SceneRootNodePtr == InChildNodePtr)
+	{
+		SceneRootNodePtr.Reset();
+	}
+
+	RemoveUnusedSeparators();
+}
+
+void FSCSRuntimeEditorTreeNodeRootActor::RemoveUnusedSeparators()
+{
 	int32 indexOfFirstSceneComponent = ComponentNodes.IndexOfByPredicate([](const FSCSRuntimeEditorTreeNodePtrType& NodePtr)
 	{
 		return NodePtr->GetNodeType() == FSCSRuntimeEditorTreeNode::ComponentNode && Cast<USceneComponent>(NodePtr->GetComponentTemplate());
@@ -1579,6 +1857,13 @@ TSharedRef<SWidget> SSCS_RuntimeRowWidget::GenerateWidgetForColumn( const FName&
 					.Padding(2, 0, 0, 0)
 					[
 						InlineWidget.ToSharedRef()
+					]
+				+SHorizontalBox::Slot()
+					.AutoWidth()
+					.VAlign(VAlign_Center)
+					.Padding(4, 0, 2, 0)
+					[
+						MakeBaselineBadgeWidget()
 					];
 	}
 	else if(ColumnName == SCS_ColumnName_Asset)
@@ -1626,6 +1911,59 @@ TSharedRef<SWidget> SSCS_RuntimeRowWidget::GenerateWidgetForColumn( const FName&
 }
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
+TSharedRef<SWidget> SSCS_RuntimeRowWidget::MakeBaselineBadgeWidget()
+{
+	SAssignNew(BaselineBadge, STextBlock);
+	UpdateBaselineBadge();
+	return BaselineBadge.ToSharedRef();
+}
+
+void SSCS_RuntimeRowWidget::UpdateBaselineBadge()
+{
+	if (!BaselineBadge.IsValid())
+	{
+		return;
+	}
+
+	ESCSRuntimeBaselineChange Change;
+	int32 NumDestroyedChildren;
+	TSharedPtr<SSCSRuntimeEditor> SCSRuntimeEditorPtr = SCSRuntimeEditor.Pin();
+	if (!SCSRuntimeEditorPtr.IsValid() || !SCSRuntimeEditorPtr->GetBaselineDiff(GetNode(), Change, NumDestroyedChildren))
+	{
+		BaselineBadge->SetVisibility(EVisibility::Collapsed);
+		return;
+	}
+
+	FText Text;
+	FText ToolTipText;
+	FLinearColor Color(0.9f, 0.3f, 0.3f);
+	if (Change == ESCSRuntimeBaselineChange::Added)
+	{
+		Text = LOCTEXT("BaselineBadgeAdded", "Added");
+		ToolTipText = LOCTEXT("BaselineBadgeAddedTooltip", "This component was added since the baseline was captured.");
+		Color = FLinearColor(0.3f, 0.8f, 0.3f);
+	}
+	else if (Change == ESCSRuntimeBaselineChange::Reattached)
+	{
+		Text = LOCTEXT("BaselineBadgeReattached", "Reattached");
+		ToolTipText = LOCTEXT("BaselineBadgeReattachedTooltip", "This component was attached to a different parent since the baseline was captured.");
+		Color = FLinearColor(0.9f, 0.7f, 0.2f);
+	}
+
+	if (NumDestroyedChildren > 0)
+	{
+		const FText DestroyedText = FText::Format(LOCTEXT("BaselineBadgeDestroyed", "-{0}"), FText::AsNumber(NumDestroyedChildren));
+		const FText DestroyedToolTipText = FText::Format(LOCTEXT("BaselineBadgeDestroyedTooltip", "{0} {0}|plural(one=component,other=components) attached here when the baseline was captured {0}|plural(one=has,other=have) been destroyed since."), FText::AsNumber(NumDestroyedChildren));
+		Text = Text.IsEmpty() ? DestroyedText : FText::Format(LOCTEXT("BaselineBadgeBoth", "{0} {1}"), Text, DestroyedText);
+		ToolTipText = ToolTipText.IsEmpty() ? DestroyedToolTipText : FText::Format(LOCTEXT("BaselineBadgeBothTooltip", "{0}\n{1}"), ToolTipText, DestroyedToolTipText);
+	}
+
+	BaselineBadge->SetText(Text);
+	BaselineBadge->SetToolTipText(ToolTipText);
+	BaselineBadge->SetColorAndOpacity(Color);
+	BaselineBadge->SetVisibility(EVisibility::Visible);
+}
+
 BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
 void SSCS_RuntimeRowWidget::AddToToolTipInfoBox(const TSharedRef<SVerticalBox>& InfoBox, const FText& Key, TSharedRef<SWidget> ValueIcon, const TAttribute<FText>& Value, bool bImportant)
 {
@@ -1757,233 +2095,257 @@ END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
 FSlateBrush const* SSCS_RuntimeRowWidget::GetMobilityIconImage() const
 {
-	if (FSCSRuntimeEditorTreeNode* TreeNode = GetNode().Get())
+	return GetNode()->GetRowViewModel().MobilityIcon;
+}
+
+FText SSCS_RuntimeRowWidget::GetMobilityToolTipText() const
+{
+	return GetNode()->GetRowViewModel().MobilityToolTip;
+}
+
+FText SSCS_RuntimeRowWidget::GetComponentAddSourceToolTipText() const
+{
+	return GetNode()->GetRowViewModel().ComponentAddSourceToolTip;
+}
+
+FText SSCS_RuntimeRowWidget::GetIntroducedInToolTipText() const
+{
+	return GetNode()->GetRowViewModel().IntroducedInToolTip;
+}
+
+FSlateBrush const* SSCS_RuntimeRowWidget::ComputeMobilityIconImage(const FSCSRuntimeEditorTreeNode& InNode)
+{
+	if (USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(InNode.GetComponentTemplate()))
 	{
-		if (USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(TreeNode->GetComponentTemplate()))
+		if (SceneComponentTemplate->Mobility == EComponentMobility::Movable)
 		{
-			if (SceneComponentTemplate->Mobility == EComponentMobility::Movable)
-			{
-				return FEditorStyle::GetBrush(TEXT("ClassIcon.MovableMobilityIcon"));
-			}
-			else if (SceneComponentTemplate->Mobility == EComponentMobility::Stationary)
-			{
-				return FEditorStyle::GetBrush(TEXT("ClassIcon.StationaryMobilityIcon"));
-			}
-
-			// static components don't get an icon (because static is the most common
-			// mobility type, and we'd like to keep the icon clutter to a minimum)
+			return FEditorStyle::GetBrush(TEXT("ClassIcon.MovableMobilityIcon"));
+		}
+		else if (SceneComponentTemplate->Mobility == EComponentMobility::Stationary)
+		{
+			return FEditorStyle::GetBrush(TEXT("ClassIcon.StationaryMobilityIcon"));
 		}
+
+		// static components don't get an icon (because static is the most common
+		// mobility type, and we'd like to keep the icon clutter to a minimum)
 	}
 
 	return nullptr;
 }
 
-FText SSCS_RuntimeRowWidget::GetMobilityToolTipText() const
+FText SSCS_RuntimeRowWidget::ComputeMobilityToolTipText(const FSCSRuntimeEditorTreeNode& InNode)
 {
 	FText MobilityToolTip = LOCTEXT("ErrorNoMobilityTooltip", "Invalid component");
 
-	if (FSCSRuntimeEditorTreeNode* TreeNode = TreeNodePtr.Get())
+	if (USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(InNode.GetComponentTemplate()))
 	{
-		if (USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(TreeNode->GetComponentTemplate()))
+		if (SceneComponentTemplate->Mobility == EComponentMobility::Movable)
 		{
-			if (SceneComponentTemplate->Mobility == EComponentMobility::Movable)
-			{
-				MobilityToolTip = LOCTEXT("MovableMobilityTooltip", "Movable");
-			}
-			else if (SceneComponentTemplate->Mobility == EComponentMobility::Stationary)
-			{
-				MobilityToolTip = LOCTEXT("StationaryMobilityTooltip", "Stationary");
-			}
-			else if (SceneComponentTemplate->Mobility == EComponentMobility::Static)
-			{
-				MobilityToolTip = LOCTEXT("StaticMobilityTooltip", "Static");
-			}
-			else
-			{
-				// make sure we're the mobility type we're expecting (we've handled Movable & Stationary)
-				ensureMsgf(false, TEXT("Unhandled mobility type [%d], is this a new type that we don't handle here?"), SceneComponentTemplate->Mobility.GetValue());
-				MobilityToolTip = LOCTEXT("UnknownMobilityTooltip", "Component with unknown mobility");
-			}
+			MobilityToolTip = LOCTEXT("MovableMobilityTooltip", "Movable");
+		}
+		else if (SceneComponentTemplate->Mobility == EComponentMobility::Stationary)
+		{
+			MobilityToolTip = LOCTEXT("StationaryMobilityTooltip", "Stationary");
+		}
+		else if (SceneComponentTemplate->Mobility == EComponentMobility::Static)
+		{
+			MobilityToolTip = LOCTEXT("StaticMobilityTooltip", "Static");
 		}
 		else
 		{
-			MobilityToolTip = LOCTEXT("NoMobilityTooltip", "Non-scene component");
+			// make sure we're the mobility type we're expecting (we've handled Movable & Stationary)
+			ensureMsgf(false, TEXT("Unhandled mobility type [%d], is this a new type that we don't handle here?"), SceneComponentTemplate->Mobility.GetValue());
+			MobilityToolTip = LOCTEXT("UnknownMobilityTooltip", "Component with unknown mobility");
 		}
 	}
+	else
+	{
+		MobilityToolTip = LOCTEXT("NoMobilityTooltip", "Non-scene component");
+	}
 
 	return MobilityToolTip;
 }
 
-FText SSCS_RuntimeRowWidget::GetComponentAddSourceToolTipText() const
+FText SSCS_RuntimeRowWidget::ComputeComponentAddSourceToolTipText(const FSCSRuntimeEditorTreeNode& InNode)
 {
 	FText NodeType;
 	
-	if (FSCSRuntimeEditorTreeNode* TreeNode = TreeNodePtr.Get())
+	if (InNode.IsInherited())
 	{
-		if (TreeNode->IsInherited())
+		if (InNode.IsNative())
 		{
-			if (TreeNode->IsNative())
-			{
-				NodeType = LOCTEXT("InheritedNativeComponent", "Inherited (C++)");
-			}
-			else
-			{
-				NodeType = LOCTEXT("InheritedBlueprintComponent", "Inherited (Blueprint)");
-			}
+			NodeType = LOCTEXT("InheritedNativeComponent", "Inherited (C++)");
 		}
 		else
 		{
-			if (TreeNode->IsInstanced())
-			{
-				NodeType = LOCTEXT("ThisInstanceAddedComponent", "This actor instance");
-			}
-			else
-			{
-				NodeType = LOCTEXT("ThisBlueprintAddedComponent", "This Blueprint");
-			}
+			NodeType = LOCTEXT("InheritedBlueprintComponent", "Inherited (Blueprint)");
+		}
+	}
+	else
+	{
+		if (InNode.IsInstanced())
+		{
+			NodeType = LOCTEXT("ThisInstanceAddedComponent", "This actor instance");
+		}
+		else
+		{
+			NodeType = LOCTEXT("ThisBlueprintAddedComponent", "This Blueprint");
 		}
 	}
 
 	return NodeType;
 }
 
-FText SSCS_RuntimeRowWidget::GetIntroducedInToolTipText() const
+FText SSCS_RuntimeRowWidget::ComputeIntroducedInToolTipText(const FSCSRuntimeEditorTreeNode& InNode)
 {
 	FText IntroducedInTooltip = LOCTEXT("IntroducedInThisBPTooltip", "this class");
 
-	if (FSCSRuntimeEditorTreeNode* TreeNode = TreeNodePtr.Get())
+	if (InNode.IsInherited())
 	{
-		if (TreeNode->IsInherited())
+		if (UActorComponent* ComponentTemplate = InNode.GetComponentTemplate())
 		{
-			if (UActorComponent* ComponentTemplate = TreeNode->GetComponentTemplate())
-			{
-				UClass* BestClass = nullptr;
-				AActor* OwningActor = ComponentTemplate->GetOwner();
+			UClass* BestClass = nullptr;
+			AActor* OwningActor = ComponentTemplate->GetOwner();
 
-				if (TreeNode->IsNative() && (OwningActor != nullptr))
+			if (InNode.IsNative() && (OwningActor != nullptr))
+			{
+				for (UClass* TestClass = OwningActor->GetClass(); TestClass != AActor::StaticClass(); TestClass = TestClass->GetSuperClass())
 				{
-					for (UClass* TestClass = OwningActor->GetClass(); TestClass != AActor::StaticClass(); TestClass = TestClass->GetSuperClass())
+					if (InNode.FindComponentInstanceInActor(Cast<AActor>(TestClass->GetDefaultObject())))
 					{
-						if (TreeNode->FindComponentInstanceInActor(Cast<AActor>(TestClass->GetDefaultObject())))
-						{
-							BestClass = TestClass;
-						}
-						else
-						{
-							break;
-						}
+						BestClass = TestClass;
 					}
-				}
-				else if (!TreeNode->IsNative())
-				{
-					USCS_Node* SCSNode = TreeNode->GetSCSNode();
-
-					if ((SCSNode == nullptr) && (OwningActor != nullptr))
+					else
 					{
-						SCSNode = FSCSRuntimeEditorTreeNode::FindSCSNodeForInstance(ComponentTemplate, OwningActor->GetClass());
+						break;
 					}
+				}
+			}
+			else if (!InNode.IsNative())
+			{
+				USCS_Node* SCSNode = InNode.GetSCSNode();
 
-					if (SCSNode != nullptr)
-					{
-						if (UBlueprint* OwningBP = SCSNode->GetSCS()->GetBlueprint())
-						{
-							BestClass = OwningBP->GeneratedClass;
-						}
-					}
-					else if (OwningActor != nullptr)
-					{
-						if (UBlueprint* OwningBP = UBlueprint::GetBlueprintFromClass(OwningActor->GetClass()))
-						{
-							BestClass = OwningBP->GeneratedClass;
-						}
-					}
+				if ((SCSNode == nullptr) && (OwningActor != nullptr))
+				{
+					SCSNode = FSCSRuntimeEditorTreeNode::FindSCSNodeForInstance(ComponentTemplate, OwningActor->GetClass());
 				}
 
-				if (BestClass == nullptr)
+				if (SCSNode != nullptr)
 				{
-					if (ComponentTemplate->IsCreatedByConstructionScript()) 
-					{
-						IntroducedInTooltip = LOCTEXT("IntroducedInUnknownError", "Unknown Blueprint Class (via an Add Component call)");
-					} 
-					else 
+					if (UBlueprint* OwningBP = SCSNode->GetSCS()->GetBlueprint())
 					{
-						IntroducedInTooltip = LOCTEXT("IntroducedInNativeError", "Unknown native source (via C++ code)");
+						BestClass = OwningBP->GeneratedClass;
 					}
 				}
-				else if (TreeNode->IsInstanced() && ComponentTemplate->CreationMethod == EComponentCreationMethod::Native && !ComponentTemplate->HasAnyFlags(RF_DefaultSubObject))
+				else if (OwningActor != nullptr)
 				{
-					IntroducedInTooltip = FText::Format(LOCTEXT("IntroducedInCPPErrorFmt", "{0} (via C++ code)"), FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass));
+					if (UBlueprint* OwningBP = UBlueprint::GetBlueprintFromClass(OwningActor->GetClass()))
+					{
+						BestClass = OwningBP->GeneratedClass;
+					}
 				}
-				else if (TreeNode->IsInstanced() && ComponentTemplate->CreationMethod == EComponentCreationMethod::UserConstructionScript)
+			}
+
+			if (BestClass == nullptr)
+			{
+				if (ComponentTemplate->IsCreatedByConstructionScript()) 
 				{
-					IntroducedInTooltip = FText::Format(LOCTEXT("IntroducedInUCSErrorFmt", "{0} (via an Add Component call)"), FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass));
-				}
-				else
+					IntroducedInTooltip = LOCTEXT("IntroducedInUnknownError", "Unknown Blueprint Class (via an Add Component call)");
+				} 
+				else 
 				{
-					IntroducedInTooltip = FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass);
+					IntroducedInTooltip = LOCTEXT("IntroducedInNativeError", "Unknown native source (via C++ code)");
 				}
 			}
+			else if (InNode.IsInstanced() && ComponentTemplate->CreationMethod == EComponentCreationMethod::Native && !ComponentTemplate->HasAnyFlags(RF_DefaultSubObject))
+			{
+				IntroducedInTooltip = FText::Format(LOCTEXT("IntroducedInCPPErrorFmt", "{0} (via C++ code)"), FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass));
+			}
+			else if (InNode.IsInstanced() && ComponentTemplate->CreationMethod == EComponentCreationMethod::UserConstructionScript)
+			{
+				IntroducedInTooltip = FText::Format(LOCTEXT("IntroducedInUCSErrorFmt", "{0} (via an Add Component call)"), FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass));
+			}
 			else
 			{
-				IntroducedInTooltip = LOCTEXT("IntroducedInNoTemplateError", "[no component template found]");
+				IntroducedInTooltip = FBlueprintEditorUtils::GetFriendlyClassDisplayName(BestClass);
 			}
 		}
-		else if (TreeNode->IsInstanced())
+		else
 		{
-			IntroducedInTooltip = LOCTEXT("IntroducedInThisActorInstanceTooltip", "this actor instance");
+			IntroducedInTooltip = LOCTEXT("IntroducedInNoTemplateError", "[no component template found]");
 		}
 	}
+	else if (InNode.IsInstanced())
+	{
+		IntroducedInTooltip = LOCTEXT("IntroducedInThisActorInstanceTooltip", "this actor instance");
+	}
 
 	return IntroducedInTooltip;
 }
 
 FText SSCS_RuntimeRowWidget::GetAssetName() const
 {
-	FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNode();
+	return GetNode()->GetRowViewModel().AssetName;
+}
 
-	FText AssetName = LOCTEXT("None", "None");
-	if(NodePtr.IsValid() && NodePtr->GetComponentTemplate())
-	{
-		UObject* Asset = FComponentAssetBrokerage::GetAssetFromComponent(NodePtr->GetComponentTemplate());
-		if(Asset != NULL)
-		{
-			AssetName = FText::FromString(Asset->GetName());
-		}
-	}
+FText SSCS_RuntimeRowWidget::GetAssetPath() const
+{
+	return GetNode()->GetRowViewModel().AssetPath;
+}
 
-	return AssetName;
+EVisibility SSCS_RuntimeRowWidget::GetAssetVisibility() const
+{
+	return GetNode()->GetRowViewModel().bSupportsAssets ? EVisibility::Visible : EVisibility::Hidden;
 }
 
-FText SSCS_RuntimeRowWidget::GetAssetPath() const
+void SSCS_RuntimeRowWidget::BuildRowViewModel(const FSCSRuntimeEditorTreeNode& InNode, FSCSRuntimeEditorRowViewModel& OutViewModel)
 {
-	FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNode();
+	OutViewModel.DisplayString = FText::FromString(InNode.GetDisplayString());
+	OutViewModel.ToolTipTitle = ComputeToolTipTitle(InNode);
+
+	// The asset is looked up once for both its name and its path, through a broker found once for the component's class
+	UActorComponent* ComponentTemplate = InNode.GetComponentTemplate();
+	OutViewModel.AssetBroker = ComponentTemplate != nullptr ? FComponentAssetBrokerage::FindBrokerByComponentType(ComponentTemplate->GetClass()) : nullptr;
+	UObject* Asset = OutViewModel.AssetBroker.IsValid() ? OutViewModel.AssetBroker->GetAssetFromComponent(ComponentTemplate) : nullptr;
+	OutViewModel.AssetName = Asset != nullptr ? FText::FromString(Asset->GetName()) : LOCTEXT("None", "None");
+	OutViewModel.AssetPath = Asset != nullptr ? FText::FromString(Asset->GetPathName()) : LOCTEXT("None", "None");
+	OutViewModel.bSupportsAssets = OutViewModel.AssetBroker.IsValid();
 
-	FText AssetName = LOCTEXT("None", "None");
-	if(NodePtr.IsValid() && NodePtr->GetComponentTemplate())
+	if (InNode.GetNodeType() == FSCSRuntimeEditorTreeNode::ComponentNode)
 	{
-		UObject* Asset = FComponentAssetBrokerage::GetAssetFromComponent(NodePtr->GetComponentTemplate());
-		if(Asset != NULL)
-		{
-			AssetName = FText::FromString(Asset->GetPathName());
-		}
+		OutViewModel.MobilityIcon = ComputeMobilityIconImage(InNode);
+		OutViewModel.MobilityToolTip = ComputeMobilityToolTipText(InNode);
+		OutViewModel.ComponentAddSourceToolTip = ComputeComponentAddSourceToolTipText(InNode);
+		OutViewModel.IntroducedInToolTip = ComputeIntroducedInToolTipText(InNode);
+	}
+	else
+	{
+		OutViewModel.MobilityIcon = nullptr;
+		OutViewModel.MobilityToolTip = FText::GetEmpty();
+		OutViewModel.ComponentAddSourceToolTip = FText::GetEmpty();
+		OutViewModel.IntroducedInToolTip = FText::GetEmpty();
 	}
 
-	return AssetName;
+	USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(ComponentTemplate);
+	OutViewModel.ComponentName = ComponentTemplate != nullptr ? ComponentTemplate->GetFName() : NAME_None;
+	OutViewModel.Asset = Asset;
+	OutViewModel.Mobility = SceneComponentTemplate != nullptr ? SceneComponentTemplate->Mobility : EComponentMobility::Static;
 }
 
-
-EVisibility SSCS_RuntimeRowWidget::GetAssetVisibility() const
+bool SSCS_RuntimeRowWidget::IsRowViewModelCurrent(const FSCSRuntimeEditorTreeNode& InNode, const FSCSRuntimeEditorRowViewModel& InViewModel)
 {
-	FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNode();
-
-	if(NodePtr.IsValid() && NodePtr->GetComponentTemplate() && FComponentAssetBrokerage::SupportsAssets(NodePtr->GetComponentTemplate()))
-	{
-		return EVisibility::Visible;
-	}
-	else
+	// Only what gameplay code commonly changes at runtime is compared (SetStaticMesh(), SetMobility(), renames); other edits go
+	// through InvalidateRowViewModel()
+	UActorComponent* ComponentTemplate = InNode.GetComponentTemplate();
+	if (ComponentTemplate == nullptr)
 	{
-		return EVisibility::Hidden;
+		return InViewModel.ComponentName == NAME_None;
 	}
+
+	USceneComponent* SceneComponentTemplate = Cast<USceneComponent>(ComponentTemplate);
+	return InViewModel.ComponentName == ComponentTemplate->GetFName()
+		&& (SceneComponentTemplate == nullptr || InViewModel.Mobility == SceneComponentTemplate->Mobility)
+		&& InViewModel.Asset == (InViewModel.AssetBroker.IsValid() ? InViewModel.AssetBroker->GetAssetFromComponent(ComponentTemplate) : nullptr);
 }
 
 FSlateColor SSCS_RuntimeRowWidget::GetColorTintForIcon() const
@@ -2082,6 +2444,18 @@ FReply SSCS_RuntimeRowWidget::OnMouseButtonDown(const FGeometry& MyGeometry, con
 	}
 }
 
+int32 SSCS_RuntimeRowWidget::DoesItemHaveChildren() const
+{
+	// Deferred children aren't handed to the tree until the row is expanded, so they only show up here
+	TSharedPtr<SSCSRuntimeEditor> SCSRuntimeEditorPtr = SCSRuntimeEditor.Pin();
+	if (SCSRuntimeEditorPtr.IsValid() && SCSRuntimeEditorPtr->HasDeferredChildren(GetNode()))
+	{
+		return 1;
+	}
+
+	return SMultiColumnTableRow<FSCSRuntimeEditorTreeNodePtrType>::DoesItemHaveChildren();
+}
+
 FReply SSCS_RuntimeRowWidget::HandleOnDragDetected( const FGeometry& MyGeometry, const FPointerEvent& MouseEvent )
 {
 	auto SCSRuntimeEditorPtr = SCSRuntimeEditor.Pin();
@@ -3049,27 +3423,20 @@ void SSCS_RuntimeRowWidget::PostDragDropAction(bool bRegenerateTreeNodes)
 
 FText SSCS_RuntimeRowWidget::GetNameLabel() const
 {
-	if( InlineWidget.IsValid() && !InlineWidget->IsInEditMode() )
-	{
-		FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNode();
-		if(NodePtr->IsInherited())
-		{
-			return FText::FromString(GetNode()->GetDisplayString());
-			//return FText::Format(LOCTEXT("NativeComponentFormatString","{0} (Inherited)"), FText::FromString(GetNode()->GetDisplayString()));
-		}
-	}
-
 	// NOTE: Whatever this returns also becomes the variable name
-	return FText::FromString(GetNode()->GetDisplayString());
+	return GetNode()->GetRowViewModel().DisplayString;
 }
 
 FText SSCS_RuntimeRowWidget::GetTooltipText() const
 {
-	FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNode();
+	return GetNode()->GetRowViewModel().ToolTipTitle;
+}
 
-	if (NodePtr->IsDefaultSceneRoot())
+FText SSCS_RuntimeRowWidget::ComputeToolTipTitle(const FSCSRuntimeEditorTreeNode& InNode)
+{
+	if (InNode.IsDefaultSceneRoot())
 	{
-		if (NodePtr->IsInherited())
+		if (InNode.IsInherited())
 		{
 			return LOCTEXT("InheritedDefaultSceneRootToolTip", "This is the default scene root component. It cannot be copied, renamed or deleted.\nIt has been inherited from the parent class, so its properties cannot be edited here.\nNew scene components will automatically be attached to it.");
 		}
@@ -3080,14 +3447,12 @@ FText SSCS_RuntimeRowWidget::GetTooltipText() const
 	}
 	else
 	{
-		UClass* Class = ( NodePtr->GetComponentTemplate() != nullptr ) ? NodePtr->GetComponentTemplate()->GetClass() : nullptr;
+		UClass* Class = ( InNode.GetComponentTemplate() != nullptr ) ? InNode.GetComponentTemplate()->GetClass() : nullptr;
 		const FText ClassDisplayName = FBlueprintEditorUtils::GetFriendlyClassDisplayName(Class);
-		const FText ComponentDisplayName = NodePtr->GetDisplayName();
-
 
 		FFormatNamedArguments Args;
 		Args.Add(TEXT("ClassName"), ClassDisplayName);
-		Args.Add(TEXT("NodeName"), FText::FromString(NodePtr->GetDisplayString()));
+		Args.Add(TEXT("NodeName"), FText::FromString(InNode.GetDisplayString()));
 
 		return FText::Format(LOCTEXT("ComponentTooltip", "{NodeName} ({ClassName})"), Args);
 	}
@@ -3228,6 +3593,8 @@ bool SSCS_RuntimeRowWidget::OnNameTextVerifyChanged(const FText& InNewText, FTex
 void SSCS_RuntimeRowWidget::OnNameTextCommit(const FText& InNewName, ETextCommit::Type InTextCommit)
 {
 	GetNode()->OnCompleteRename(InNewName);
+	GetNode()->InvalidateFilterKey();
+	GetNode()->InvalidateRowViewModel();
 
 	// No need to call UpdateTree() in SCS editor mode; it will already be called by MBASM internally
 	check(SCSRuntimeEditor.IsValid());
@@ -3288,6 +3655,14 @@ TSharedRef<SWidget> SSCS_RuntimeRowWidget_ActorRoot::GenerateWidgetForColumn(con
 			SNew(STextBlock)
 			.Text(this, &SSCS_RuntimeRowWidget_ActorRoot::GetActorContextText)
 			.ColorAndOpacity(FSlateColor::UseForeground())
+		]
+
+	+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(4.0f, 0.0f, 2.0f, 0.0f)
+		[
+			MakeBaselineBadgeWidget()
 		];
 }
 
@@ -3401,7 +3776,12 @@ FText SSCS_RuntimeRowWidget_ActorRoot::GetActorContextText() const
 		TSharedPtr<SSCSRuntimeEditor> SCSRuntimeEditorPtr = SCSRuntimeEditor.Pin();
 		if (AActor* DefaultActor = SCSRuntimeEditorPtr->GetActorContext())
 		{
-			if (UBlueprint* Blueprint = UBlueprint::GetBlueprintFromClass(DefaultActor->GetClass()))
+			const int32 NumMergedActors = SCSRuntimeEditorPtr->GetNumMergedActors();
+			if (NumMergedActors > 0)
+			{
+				return FText::Format(LOCTEXT("ActorContext_Merged", " (+{0} more)"), FText::AsNumber(NumMergedActors));
+			}
+			else if (UBlueprint* Blueprint = UBlueprint::GetBlueprintFromClass(DefaultActor->GetClass()))
 			{
 				return LOCTEXT("ActorContext_self", " (self)");
 			}
@@ -3516,6 +3896,16 @@ void SSCSRuntimeEditor::Construct( const FArguments& InArgs )
 	bUpdatingSelection = false;
 	bAllowTreeUpdates = true;
 	bIsDiffing = InArgs._IsDiffing;
+	bTreeNodeIndexComplete = false;
+	bNameIndexComplete = false;
+	NameIndexStructureGeneration = 0;
+	SelectionGeneration = 1;
+	CachedSelectionGeneration = 0;
+	bIsFilterActive = false;
+	bBaselineModeEnabled = false;
+	NumDestroyedUnderActorNode = 0;
+	GeneratedRowsPruneThreshold = 64;
+	bLastTreeModelCurrent = false;
 
 	CommandList = MakeShareable( new FUICommandList );
 	CommandList->MapAction( FGenericCommands::Get().Cut,
@@ -3564,6 +3954,7 @@ void SSCSRuntimeEditor::Construct( const FArguments& InArgs )
 		.OnGenerateRow(this, &SSCSRuntimeEditor::MakeTableRowWidget)
 		.OnGetChildren(this, &SSCSRuntimeEditor::OnGetChildrenForTree)
 		.OnSetExpansionRecursive(this, &SSCSRuntimeEditor::SetItemExpansionRecursive)
+		.OnExpansionChanged(this, &SSCSRuntimeEditor::OnItemExpansionChanged)
 		.OnSelectionChanged(this, &SSCSRuntimeEditor::OnTreeSelectionChanged)
 		.OnContextMenuOpening(this, &SSCSRuntimeEditor::CreateContextMenu)
 		.OnItemScrolledIntoView(this, &SSCSRuntimeEditor::OnItemScrolledIntoView)
@@ -3804,7 +4195,42 @@ void SSCSRuntimeEditor::Construct( const FArguments& InArgs )
 			.VAlign(VAlign_Center)
 			.Padding(3.0f, 1.0f)
 		[
-			SearchBar.ToSharedRef()
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.VAlign(VAlign_Center)
+			[
+				SearchBar.ToSharedRef()
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(3.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SCheckBox)
+				.Style(FEditorStyle::Get(), "ToggleButtonCheckbox")
+				.IsChecked(this, &SSCSRuntimeEditor::GetBaselineModeCheckState)
+				.OnCheckStateChanged(this, &SSCSRuntimeEditor::OnBaselineModeCheckStateChanged)
+				.ToolTipText(LOCTEXT("BaselineModeTooltip", "Show the components added, destroyed or reattached since play started with this enabled, or since the Actor was first shown if it had no baseline yet."))
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("BaselineMode", "Baseline"))
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(3.0f, 0.0f, 0.0f, 0.0f)
+			[
+				SNew(SButton)
+				.ButtonStyle(FEditorStyle::Get(), "FlatButton")
+				.Visibility(this, &SSCSRuntimeEditor::GetRecaptureBaselineVisibility)
+				.OnClicked(this, &SSCSRuntimeEditor::OnRecaptureBaselineClicked)
+				.ToolTipText(LOCTEXT("RecaptureBaselineTooltip", "Record the current components of this Actor as its new baseline."))
+				[
+					SNew(STextBlock)
+					.Text(LOCTEXT("RecaptureBaseline", "Recapture"))
+				]
+			]
 		];
 	}
 
@@ -3820,7 +4246,13 @@ void SSCSRuntimeEditor::Construct( const FArguments& InArgs )
 	{
 		GEngine->OnLevelComponentRequestRename().AddSP(this, &SSCSRuntimeEditor::OnLevelComponentRequestRename);
 		GEditor->OnObjectsReplaced().AddSP(this, &SSCSRuntimeEditor::OnObjectsReplaced);
+		FCoreUObjectDelegates::OnObjectPropertyChanged.AddSP(this, &SSCSRuntimeEditor::OnObjectPropertyChanged);
+		FEditorDelegates::PostPIEStarted.AddSP(this, &SSCSRuntimeEditor::OnPIEStarted);
 	}
+
+	// Gameplay code may change what a row shows at any time (e.g. through SetStaticMesh() or SetMobility()); only the rows that
+	// exist are checked, so the cost follows the rows in view rather than the size of the tree
+	RegisterActiveTimer(FMath::Max(CVarRowRevalidateInterval.GetValueOnGameThread(), 0.f), FWidgetActiveTimerDelegate::CreateSP(this, &SSCSRuntimeEditor::RevalidateGeneratedRows));
 }
 END_SLATE_FUNCTION_BUILD_OPTIMIZATION
 
@@ -3836,11 +4268,27 @@ void SSCSRuntimeEditor::OnLevelComponentRequestRename(const UActorComponent* InC
 	}
 }
 
+void SSCSRuntimeEditor::OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent)
+{
+	// Only the row of the edited component shows stale values (e.g. its asset or mobility), so the other rows keep theirs
+	if (const UActorComponent* Component = Cast<UActorComponent>(InObject))
+	{
+		if (const TWeakPtr<FSCSRuntimeEditorTreeNode>* IndexedNode = ComponentToNodeIndex.Find(Component))
+		{
+			if (FSCSRuntimeEditorTreeNodePtrType Node = IndexedNode->Pin())
+			{
+				Node->InvalidateRowViewModel();
+			}
+		}
+	}
+}
+
 void SSCSRuntimeEditor::OnObjectsReplaced(const TMap<UObject*, UObject*>& OldToNewInstanceMap)
 {
 	if (GetActorNode().IsValid())
 	{
 		ReplaceComponentReferencesInTree(GetActorNode()->GetComponentNodes(), OldToNewInstanceMap);
+		++SelectionGeneration;
 	}
 }
 
@@ -3861,6 +4309,9 @@ void SSCSRuntimeEditor::ReplaceComponentReferencesInTree(const TArray<FSCSRuntim
 					if (UActorComponent* NewComponentTemplate = Cast<UActorComponent>(*NewComponentTemplatePtr))
 					{
 						Node->SetComponentTemplate(NewComponentTemplate);
+
+						ComponentToNodeIndex.Remove(ComponentTemplate);
+						IndexTreeNode(Node);
 					}
 				}
 			}
@@ -3904,17 +4355,30 @@ TSharedRef<ITableRow> SSCSRuntimeEditor::MakeTableRowWidget( FSCSRuntimeEditorTr
 	}
 
 	// Create the node of the appropriate type
+	TSharedPtr<SSCS_RuntimeRowWidget> RowWidget;
 	if (InNodePtr->GetNodeType() == FSCSRuntimeEditorTreeNode::RootActorNode)
 	{
-		return SNew(SSCS_RuntimeRowWidget_ActorRoot, SharedThis(this), InNodePtr, OwnerTable);
+		RowWidget = SNew(SSCS_RuntimeRowWidget_ActorRoot, SharedThis(this), InNodePtr, OwnerTable);
 	}
 	else if (InNodePtr->GetNodeType() == FSCSRuntimeEditorTreeNode::SeparatorNode)
 	{
-		return SNew(SSCS_RuntimeRowWidget_Separator, SharedThis(this), InNodePtr, OwnerTable);
+		RowWidget = SNew(SSCS_RuntimeRowWidget_Separator, SharedThis(this), InNodePtr, OwnerTable);
+	}
+	else
+	{
+		RowWidget = SNew(SSCS_RuntimeRowWidget, SharedThis(this), InNodePtr, OwnerTable)
+			.AddMetaData<FTutorialMetaData>(TagMeta);
 	}
 
-	return SNew(SSCS_RuntimeRowWidget, SharedThis(this), InNodePtr, OwnerTable)
-		.AddMetaData<FTutorialMetaData>(TagMeta);
+	// The tree releases rows as they scroll out of view, so the expired entries are dropped whenever the list has doubled
+	if (GeneratedRows.Num() >= GeneratedRowsPruneThreshold)
+	{
+		GeneratedRows.RemoveAllSwap([](const TWeakPtr<SSCS_RuntimeRowWidget>& GeneratedRow) { return !GeneratedRow.IsValid(); });
+		GeneratedRowsPruneThreshold = FMath::Max(GeneratedRows.Num() * 2, 64);
+	}
+	GeneratedRows.Add(RowWidget);
+
+	return RowWidget.ToSharedRef();
 }
 
 void SSCSRuntimeEditor::GetSelectedItemsForContextMenu(TArray<FComponentEventConstructionData>& OutSelectedItems) const
@@ -4394,11 +4858,11 @@ void SSCSRuntimeEditor::OnGetChildrenForTree( FSCSRuntimeEditorTreeNodePtrType I
 	if (InNodePtr.IsValid())
 	{
 		const TArray<FSCSRuntimeEditorTreeNodePtrType>& Children = InNodePtr->GetChildren();
-		OutChildren.Reserve(Children.Num());
+		OutChildren.Reset(Children.Num());
 
-		if (!GetFilterText().IsEmpty())
+		if (bIsFilterActive)
 		{
-			for (FSCSRuntimeEditorTreeNodePtrType Child : Children)
+			for (const FSCSRuntimeEditorTreeNodePtrType& Child : Children)
 			{
 				if (!Child->IsFlaggedForFiltration())
 				{
@@ -4580,6 +5044,16 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::GetNodeFromActorComponent(co
 	return NodePtr;
 }
 
+FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::MaterializeNodeFromActorComponent(const UActorComponent* ActorComponent, bool bIncludeAttachedComponents)
+{
+	if (ActorComponent != nullptr && DeferredTreeParents.Contains(ActorComponent))
+	{
+		MaterializeDeferredComponent(ActorComponent);
+	}
+
+	return GetNodeFromActorComponent(ActorComponent, bIncludeAttachedComponents);
+}
+
 void SSCSRuntimeEditor::SelectRoot()
 {
 	const TArray<FSCSRuntimeEditorTreeNodePtrType>& Nodes = GetRootNodes();
@@ -4675,8 +5149,133 @@ void SSCSRuntimeEditor::HighlightTreeNode(const USCS_Node* Node, FName Property)
 	}
 }
 
+/**
+ * The component hierarchy of an Actor instance, in the order the component tree adds its nodes. Without merged Actors it only
+ * depends on the Actor, so it is shared by every tree showing that Actor, until the components or their attachment change.
+ */
+struct FSCSRuntimeEditorTreeModel
+{
+	struct FEntry
+	{
+		UActorComponent* Component;
+		// Index of the entry of the attach parent the component is shown under, or INDEX_NONE if it's shown under the Actor node
+		int32 ParentIndex;
+	};
+
+	// Every component represented in the tree
+	TSet<UActorComponent*> Components;
+
+	// The root component followed by its attachment hierarchy breadth first, then the unattached scene components, then the
+	// non-scene components
+	TArray<FEntry> Entries;
+
+	// Scratch bits for BuildEntries, indexed like the elements of Components
+	TBitArray<> PlacedComponents;
+
+	// What the model was built from, to tell whether it's still current
+	TWeakObjectPtr<AActor> Actor;
+	int32 NumActorComponents;
+	USceneComponent* RootComponent;
+	uint32 StructureHash;
+	// A merged model may still be registered as the shared model of its Actor, so it must never match
+	bool bMerged = false;
+
+	/** @return A hash of everything the model is built from: the components of the Actor, which are pending kill, and the attach children of each, in order */
+	static uint32 ComputeStructureHash(const AActor* InActorInstance)
+	{
+		uint32 Hash = GetTypeHash(InActorInstance->GetRootComponent());
+		for (const UActorComponent* Component : InActorInstance->GetComponents())
+		{
+			Hash = HashCombine(Hash, GetTypeHash(Component));
+			if (Component != nullptr)
+			{
+				Hash = HashCombine(Hash, GetTypeHash(Component->IsPendingKill()));
+				if (const USceneComponent* SceneComponent = Cast<USceneComponent>(Component))
+				{
+					for (const USceneComponent* ChildComponent : SceneComponent->GetAttachChildren())
+					{
+						Hash = HashCombine(Hash, GetTypeHash(ChildComponent));
+					}
+				}
+			}
+		}
+
+		return Hash;
+	}
+
+	/** Orders the components into Entries; Components must be filled in already */
+	void BuildEntries(AActor* InActorInstance)
+	{
+		// Components that have an entry already are marked by their index in the set, rather than removed from a copy of it
+		PlacedComponents.Init(false, Components.GetMaxIndex());
+		Entries.Reset(Components.Num() + 1);
+
+		auto PlaceComponent = [this](UActorComponent* Component) -> bool
+		{
+			const FSetElementId ElementId = Components.FindId(Component);
+			if (!ElementId.IsValidId() || PlacedComponents[ElementId.AsInteger()])
+			{
+				return false;
+			}
+
+			PlacedComponents[ElementId.AsInteger()] = true;
+			return true;
+		};
+
+		// The root component is always added, and the components attached through it are added beneath it
+		if (USceneComponent* Root = InActorInstance->GetRootComponent())
+		{
+			PlaceComponent(Root);
+			Entries.Add(FEntry{ Root, INDEX_NONE });
+
+			for (int32 EntryIndex = 0; EntryIndex < Entries.Num(); ++EntryIndex)
+			{
+				USceneComponent* SceneComponent = CastChecked<USceneComponent>(Entries[EntryIndex].Component);
+				for (USceneComponent* ChildComponent : SceneComponent->GetAttachChildren())
+				{
+					if (ChildComponent != nullptr
+						&& ChildComponent->GetOwner() == SceneComponent->GetOwner()
+						&& PlaceComponent(ChildComponent))
+					{
+						Entries.Add(FEntry{ ChildComponent, EntryIndex });
+					}
+				}
+			}
+		}
+
+		// Each of the remaining groups keeps its order from the component set
+		for (TSet<UActorComponent*>::TConstIterator It(Components); It; ++It)
+		{
+			if (!PlacedComponents[It.GetId().AsInteger()] && (*It)->IsA<USceneComponent>())
+			{
+				Entries.Add(FEntry{ *It, INDEX_NONE });
+			}
+		}
+
+		for (TSet<UActorComponent*>::TConstIterator It(Components); It; ++It)
+		{
+			if (!PlacedComponents[It.GetId().AsInteger()] && !(*It)->IsA<USceneComponent>())
+			{
+				Entries.Add(FEntry{ *It, INDEX_NONE });
+			}
+		}
+	}
+
+	/** @return True if the model still matches the given Actor, whose structure hash is given */
+	bool IsCurrent(const AActor* InActorInstance, uint32 InStructureHash) const
+	{
+		return !bMerged
+			&& Actor.Get() == InActorInstance
+			&& NumActorComponents == InActorInstance->GetComponents().Num()
+			&& RootComponent == InActorInstance->GetRootComponent()
+			&& StructureHash == InStructureHash;
+	}
+};
+
 void SSCSRuntimeEditor::UpdateTree(bool bRegenerateTreeNodes)
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_UpdateTree);
+
 	check(SCSTreeWidget.IsValid());
 
 	// Early exit if we're deferring tree updates
@@ -4685,21 +5284,89 @@ void SSCSRuntimeEditor::UpdateTree(bool bRegenerateTreeNodes)
 		return;
 	}
 
+	// The components may have changed since the last update, so the tree model has to be checked again
+	bLastTreeModelCurrent = false;
+
+	// In Actor instance mode, try to patch the existing tree in place first; this keeps node identity (and with it the
+	// expansion and selection state) and avoids rebuilding every node on each component edit
+	if(bRegenerateTreeNodes && EditorMode == EComponentEditorMode::ActorInstance && ReconcileInstancedTreeNodes())
+	{
+		INC_DWORD_STAT(STAT_SCSRuntimeEditor_TreeReconciles);
+		bRegenerateTreeNodes = false;
+	}
+	else if(!bRegenerateTreeNodes)
+	{
+		// Nodes may have been moved, added or renamed directly (e.g. drag/drop, paste), so don't trust a lookup table miss until it's rebuilt
+		bTreeNodeIndexComplete = false;
+		bNameIndexComplete = false;
+	}
+
 	if(bRegenerateTreeNodes)
 	{
+		INC_DWORD_STAT(STAT_SCSRuntimeEditor_TreeRebuilds);
+
 		// Obtain the set of expandable tree nodes that are currently collapsed
-		TSet<FSCSRuntimeEditorTreeNodePtrType> CollapsedTreeNodes;
+		TSet<FSCSRuntimeEditorTreeNodePtrType>& CollapsedTreeNodes = TreeBuildCollapsedNodes;
+		CollapsedTreeNodes.Reset();
 		GetCollapsedNodes(GetSceneRootNode(), CollapsedTreeNodes);
 
 		// Obtain the list of selected items
 		TArray<FSCSRuntimeEditorTreeNodePtrType> SelectedTreeNodes = SCSTreeWidget->GetSelectedItems();
 
+		// Child actor nodes are rebuilt collapsed, so record the ones that are shown expanded, parents first, to expand them again
+		TArray<const UActorComponent*>& ExpandedChildActorComponents = TreeBuildExpandedChildActorComponents;
+		ExpandedChildActorComponents.Reset();
+		if (EditorMode == EComponentEditorMode::ActorInstance)
+		{
+			const AActor* ActorInstance = GetActorContext();
+			TArray<FSCSRuntimeEditorTreeNodePtrType, TInlineAllocator<64>> NodeStack;
+			for (int32 RootIndex = RootNodes.Num() - 1; RootIndex >= 0; --RootIndex)
+			{
+				NodeStack.Add(RootNodes[RootIndex]);
+			}
+
+			while (NodeStack.Num() > 0)
+			{
+				// Nothing below a collapsed node is shown
+				FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+				if (!NodePtr.IsValid() || !SCSTreeWidget->IsItemExpanded(NodePtr))
+				{
+					continue;
+				}
+
+				const TArray<FSCSRuntimeEditorTreeNodePtrType>& Children = NodePtr->GetChildren();
+				const UActorComponent* Component = NodePtr->GetComponentTemplate();
+				if (Component != nullptr
+					&& (Component->GetOwner() != ActorInstance || Component->IsA<UChildActorComponent>())
+					&& (Children.Num() > 0 || HasDeferredChildren(NodePtr)))
+				{
+					ExpandedChildActorComponents.Add(Component);
+				}
+
+				// Pushed in reverse so that parents are always recorded before their children
+				for (int32 ChildIndex = Children.Num() - 1; ChildIndex >= 0; --ChildIndex)
+				{
+					NodeStack.Add(Children[ChildIndex]);
+				}
+			}
+		}
+
 		// Clear the current tree
 		if (SelectedTreeNodes.Num() != 0)
 		{
 			SCSTreeWidget->ClearSelection();
 		}
 		RootNodes.Empty();
+		DeferredChildComponents.Reset();
+		DeferredTreeParents.Reset();
+		ChildActorPrimitiveOwners.Reset();
+
+		// Every node added below goes through AddTreeNode() or AddTreeNodeFromComponent(), which keep the lookup tables up to date
+		ComponentToNodeIndex.Reset();
+		SCSNodeToNodeIndex.Reset();
+		NameToNodeIndex.Reset();
+		bTreeNodeIndexComplete = true;
+		bNameIndexComplete = false;
 
 		TSharedPtr<FSCSRuntimeEditorTreeNode> ActorTreeNode = MakeShareable(new FSCSRuntimeEditorTreeNodeRootActor(GetActorContext(),EditorMode == EComponentEditorMode::ActorInstance));
 		RefreshFilteredState(ActorTreeNode, false);
@@ -4813,132 +5480,1027 @@ void SSCSRuntimeEditor::UpdateTree(bool bRegenerateTreeNodes)
 			// Get the actor instance that we're editing
 			if (AActor* ActorInstance = GetActorContext())
 			{
-				// Get the full set of instanced components
-				TSet<UActorComponent*> ComponentsToAdd(ActorInstance->GetComponents());
+				// Get the component hierarchy to show, which other trees showing the same Actor may have built already this frame. The
+				// scratch containers used below are members, so that once they have grown to fit the Actor, regenerating the tree
+				// doesn't allocate anything but the nodes themselves.
+				TSharedRef<const FSCSRuntimeEditorTreeModel> TreeModel = GetTreeModel(ActorInstance);
 
-				const bool bHideConstructionScriptComponentsInDetailsView = GetDefault<UBlueprintEditorSettings>()->bHideConstructionScriptComponentsInDetailsView;
-				auto ShouldAddInstancedActorComponent = [bHideConstructionScriptComponentsInDetailsView](UActorComponent* ActorComp, USceneComponent* ParentSceneComp)
+				// Nodes that were collapsed keep their children deferred, since they won't be shown
+				TSet<const UActorComponent*>& CollapsedComponents = TreeBuildCollapsedComponents;
+				CollapsedComponents.Reset();
+				for (const FSCSRuntimeEditorTreeNodePtrType& CollapsedTreeNode : CollapsedTreeNodes)
 				{
-					return true;
-					// Exclude nested DSOs attached to BP-constructed instances, which are not mutable.
-					//return (ActorComp != nullptr
-					//	&& (!ActorComp->IsVisualizationComponent())
-					//	&& (ActorComp->CreationMethod != EComponentCreationMethod::UserConstructionScript || !bHideConstructionScriptComponentsInDetailsView)
-					//	&& (ParentSceneComp == nullptr || !ParentSceneComp->IsCreatedByConstructionScript() || !ActorComp->HasAnyFlags(RF_DefaultSubObject)))
-					//	&& (ActorComp->CreationMethod != EComponentCreationMethod::Native || FComponentEditorUtils::CanEditNativeComponent(ActorComp));
-				};
-
-				for (auto It(ComponentsToAdd.CreateIterator()); It; ++It)
+					CollapsedComponents.Add(CollapsedTreeNode->GetComponentTemplate());
+				}
+
+				const int32 NodeBudget = CVarTreeNodeBudget.GetValueOnGameThread();
+				int32 NumNodesBuilt = 0;
+
+				// The model lists the attachment hierarchy under the root component breadth first, so the node budget is spent on the
+				// top of the tree; below that, only which nodes to build once their parent is expanded is recorded. The children of a
+				// node are contiguous, and are built or deferred as a whole so a node is never left partially built.
+				TArray<FSCSRuntimeEditorTreeNodePtrType>& EntryNodes = TreeBuildNodes;
+				EntryNodes.Reset();
+				EntryNodes.AddDefaulted(TreeModel->Entries.Num());
+
+				int32 CurrentParentIndex = INDEX_NONE;
+				bool bBuildChildren = false;
+				for (int32 EntryIndex = 0; EntryIndex < TreeModel->Entries.Num(); ++EntryIndex)
 				{
-					UActorComponent* ActorComp = *It;
-					USceneComponent* SceneComp = Cast<USceneComponent>(ActorComp);
-					USceneComponent* ParentSceneComp = SceneComp != nullptr ? SceneComp->GetAttachParent() : nullptr;
-					if (!ShouldAddInstancedActorComponent(ActorComp, ParentSceneComp))
+					const FSCSRuntimeEditorTreeModel::FEntry& Entry = TreeModel->Entries[EntryIndex];
+					if (Entry.ParentIndex == INDEX_NONE)
 					{
-						It.RemoveCurrent();
+						// The root component, unattached scene components and non-scene components go under the Actor node
+						EntryNodes[EntryIndex] = AddTreeNodeFromComponent(Entry.Component, FindOrCreateParentForExistingComponent(Entry.Component, GetActorNode()));
+						CurrentParentIndex = INDEX_NONE;
+						continue;
 					}
-				}
 
-				TFunction<void(USceneComponent*,FSCSRuntimeEditorTreeNodePtrType)> AddInstancedTreeNodesRecursive = [&](USceneComponent* Component, FSCSRuntimeEditorTreeNodePtrType TreeNode)
-				{
-					if (Component != nullptr)
+					const FSCSRuntimeEditorTreeNodePtrType& ParentTreeNode = EntryNodes[Entry.ParentIndex];
+					UActorComponent* ParentComponent = TreeModel->Entries[Entry.ParentIndex].Component;
+					if (Entry.ParentIndex != CurrentParentIndex)
 					{
-						TArray<USceneComponent*> Components = Component->GetAttachChildren();
-						for (USceneComponent* ChildComponent : Components)
+						CurrentParentIndex = Entry.ParentIndex;
+						bBuildChildren = ParentTreeNode.IsValid() && !CollapsedComponents.Contains(ParentComponent) && (NodeBudget <= 0 || NumNodesBuilt < NodeBudget);
+						if (!bBuildChildren && ParentTreeNode.IsValid())
 						{
-							if (ComponentsToAdd.Contains(ChildComponent)
-								&& ChildComponent->GetOwner() == Component->GetOwner())
-							{
-								ComponentsToAdd.Remove(ChildComponent);
-
-								FSCSRuntimeEditorTreeNodePtrType NewParentNode = AddTreeNodeFromComponent(ChildComponent, TreeNode);
-								AddInstancedTreeNodesRecursive(ChildComponent, NewParentNode);
-							}
+							SCSTreeWidget->SetItemExpansion(ParentTreeNode, false);
 						}
 					}
-				};
 
-				// Add the root component first (it may not be the first one)
-				USceneComponent* RootComponent = ActorInstance->GetRootComponent();
-				if(RootComponent != nullptr)
-				{
-					ComponentsToAdd.Remove(RootComponent);
+					if (bBuildChildren)
+					{
+						EntryNodes[EntryIndex] = AddTreeNodeFromComponent(Entry.Component, ParentTreeNode);
+						++NumNodesBuilt;
+					}
+					else
+					{
+						DeferTreeComponent(Entry.Component, ParentComponent);
+					}
+				}
 
-					// Recursively add any instanced children that are already attached through the root, and keep track of added
-					// instances. This will be a faster path than the loop below, because we create new parent tree nodes as we go.
-					FSCSRuntimeEditorTreeNodePtrType NewParentNode = AddTreeNodeFromComponent(RootComponent, FindOrCreateParentForExistingComponent(RootComponent, GetActorNode()));
-					AddInstancedTreeNodesRecursive(RootComponent, NewParentNode);
+				// Child actors are shown inline below the component that spawned them, and are only built once it is expanded
+				for (const FSCSRuntimeEditorTreeModel::FEntry& Entry : TreeModel->Entries)
+				{
+					if (UChildActorComponent* ChildActorComponent = Cast<UChildActorComponent>(Entry.Component))
+					{
+						DeferChildActorTree(ChildActorComponent);
+					}
 				}
 
-				// Sort components by type (always put scene components first in the tree)
-				ComponentsToAdd.Sort([](const UActorComponent& A, const UActorComponent& /* B */)
+				// Release the node references, but keep the memory
+				EntryNodes.Reset();
+				CollapsedComponents.Reset();
+			}
+		}
+
+		// Restore the previous expansion state on the new tree nodes
+		for(const FSCSRuntimeEditorTreeNodePtrType& CollapsedTreeNode : CollapsedTreeNodes)
+		{
+			// Look for a component match in the new hierarchy; if found, mark it as collapsed to match the previous setting (nodes
+			// that weren't built yet are collapsed already, so there's no need to build them)
+			const UActorComponent* CollapsedComponent = CollapsedTreeNode->GetComponentTemplate();
+			FSCSRuntimeEditorTreeNodePtrType NodeToExpandPtr = DeferredTreeParents.Contains(CollapsedComponent) ? FSCSRuntimeEditorTreeNodePtrType() : FindTreeNode(CollapsedComponent);
+			if(NodeToExpandPtr.IsValid())
+			{
+				SCSTreeWidget->SetItemExpansion(NodeToExpandPtr, false);
+			}
+		}
+		CollapsedTreeNodes.Reset();
+
+		// Expand the child actor nodes that were expanded before, building the nodes down to them
+		for (const UActorComponent* ExpandedComponent : ExpandedChildActorComponents)
+		{
+			FSCSRuntimeEditorTreeNodePtrType NodeToExpandPtr = MaterializeDeferredComponent(ExpandedComponent);
+			if (NodeToExpandPtr.IsValid())
+			{
+				SCSTreeWidget->SetItemExpansion(NodeToExpandPtr, true);
+			}
+		}
+		ExpandedChildActorComponents.Reset();
+
+		if(SelectedTreeNodes.Num() > 0)
+		{
+			// Restore the previous selection state on the new tree nodes
+			for (int i = 0; i < SelectedTreeNodes.Num(); ++i)
+			{
+				if (SelectedTreeNodes[i]->GetNodeType() == FSCSRuntimeEditorTreeNode::RootActorNode)
 				{
-					return A.IsA<USceneComponent>();
-				});
+					SCSTreeWidget->SetItemSelection(ActorTreeNode, true);
+				}
+				else
+				{
+					FSCSRuntimeEditorTreeNodePtrType NodeToSelectPtr = MaterializeDeferredComponent(SelectedTreeNodes[i]->GetComponentTemplate());
+					if (NodeToSelectPtr.IsValid())
+					{
+						SCSTreeWidget->SetItemSelection(NodeToSelectPtr, true);
+					}
+				}
+			}
 
-				// Now add any remaining instanced owned components not already added above. This will first add any
-				// unattached scene components followed by any instanced non-scene components owned by the Actor instance.
-				for (UActorComponent* ActorComp : ComponentsToAdd)
+			if (GetEditorMode() != EComponentEditorMode::BlueprintSCS)
+			{
+				TArray<FSCSRuntimeEditorTreeNodePtrType> NewSelectedTreeNodes = SCSTreeWidget->GetSelectedItems();
+				if (NewSelectedTreeNodes.Num() == 0)
 				{
-					AddTreeNodeFromComponent(ActorComp, FindOrCreateParentForExistingComponent(ActorComp, GetActorNode()));
+					SCSTreeWidget->SetItemSelection(GetRootNodes()[0], true);
 				}
 			}
 		}
 
-		// Restore the previous expansion state on the new tree nodes
-		TArray<FSCSRuntimeEditorTreeNodePtrType> CollapsedTreeNodeArray = CollapsedTreeNodes.Array();
-		for(int32 i = 0; i < CollapsedTreeNodeArray.Num(); ++i)
+		// If we have a pending deferred rename request, redirect it to the new tree node
+		if(DeferredRenameRequest != NAME_None)
+		{
+			FSCSRuntimeEditorTreeNodePtrType NodeToRenamePtr = FindTreeNode(DeferredRenameRequest);
+			if(NodeToRenamePtr.IsValid())
+			{
+				SCSTreeWidget->RequestScrollIntoView(NodeToRenamePtr);
+			}
+		}
+	}
+
+	// Nodes may have been replaced or dropped without a selection change being broadcast
+	++SelectionGeneration;
+
+	if (EditorMode == EComponentEditorMode::ActorInstance)
+	{
+		UpdateBaselineDiff();
+	}
+
+	// refresh widget
+	SCSTreeWidget->RequestTreeRefresh();
+}
+
+void SSCSRuntimeEditor::GetInstancedComponentsForTree(AActor* InActorInstance, TSet<UActorComponent*>& OutComponents)
+{
+	check(InActorInstance != nullptr);
+
+	OutComponents.Reset();
+	OutComponents.Reserve(InActorInstance->GetComponents().Num());
+
+	const bool bHideConstructionScriptComponentsInDetailsView = GetDefault<UBlueprintEditorSettings>()->bHideConstructionScriptComponentsInDetailsView;
+	auto ShouldAddInstancedActorComponent = [bHideConstructionScriptComponentsInDetailsView](UActorComponent* ActorComp, USceneComponent* ParentSceneComp)
+	{
+		return true;
+		// Exclude nested DSOs attached to BP-constructed instances, which are not mutable.
+		//return (ActorComp != nullptr
+		//	&& (!ActorComp->IsVisualizationComponent())
+		//	&& (ActorComp->CreationMethod != EComponentCreationMethod::UserConstructionScript || !bHideConstructionScriptComponentsInDetailsView)
+		//	&& (ParentSceneComp == nullptr || !ParentSceneComp->IsCreatedByConstructionScript() || !ActorComp->HasAnyFlags(RF_DefaultSubObject)))
+		//	&& (ActorComp->CreationMethod != EComponentCreationMethod::Native || FComponentEditorUtils::CanEditNativeComponent(ActorComp));
+	};
+
+	for (UActorComponent* ActorComp : InActorInstance->GetComponents())
+	{
+		if (ActorComp != nullptr && !ActorComp->IsPendingKill())
+		{
+			USceneComponent* SceneComp = Cast<USceneComponent>(ActorComp);
+			USceneComponent* ParentSceneComp = SceneComp != nullptr ? SceneComp->GetAttachParent() : nullptr;
+			if (ShouldAddInstancedActorComponent(ActorComp, ParentSceneComp))
+			{
+				OutComponents.Add(ActorComp);
+			}
+		}
+	}
+
+	MergeInstancedComponents(InActorInstance, OutComponents);
+}
+
+/** The model of each Actor shown by a tree; a model is dropped once no tree holds on to it */
+static TMap<TWeakObjectPtr<AActor>, TWeakPtr<FSCSRuntimeEditorTreeModel>> SharedTreeModels;
+
+TSharedRef<const FSCSRuntimeEditorTreeModel> SSCSRuntimeEditor::GetTreeModel(AActor* InActorInstance)
+{
+	check(InActorInstance != nullptr);
+
+	// The rebuild that follows a failed reconcile asks again within the same update, in which nothing changes the Actor. A model no
+	// other tree holds can't have been rebuilt in place in between either, so it is returned without hashing the Actor again.
+	if (bLastTreeModelCurrent && LastTreeModel.IsUnique() && LastTreeModel->Actor.Get() == InActorInstance)
+	{
+		return LastTreeModel.ToSharedRef();
+	}
+
+	// Merging depends on the other selected Actors, so merged models aren't shared, and don't need a hash to tell whether they are
+	const bool bShared = MergedActors.Num() == 0;
+	uint32 StructureHash = 0;
+	TSharedPtr<FSCSRuntimeEditorTreeModel> TreeModel;
+	if (bShared)
+	{
+		StructureHash = FSCSRuntimeEditorTreeModel::ComputeStructureHash(InActorInstance);
+		TreeModel = SharedTreeModels.FindRef(InActorInstance).Pin();
+		if (TreeModel.IsValid() && TreeModel->IsCurrent(InActorInstance, StructureHash))
+		{
+			INC_DWORD_STAT(STAT_SCSRuntimeEditor_SharedTreeModelHits);
+			MergedComponentInstances.Reset();
+			LastTreeModel = TreeModel;
+			bLastTreeModelCurrent = true;
+			return TreeModel.ToSharedRef();
+		}
+	}
+
+	// A stale shared model is rebuilt in place, since the trees holding on to it only read it while they update. Otherwise, build
+	// into the model this tree built last once nothing else holds on to it, so that its containers keep their memory.
+	if (!TreeModel.IsValid())
+	{
+		if (!LastTreeModel.IsValid() || !LastTreeModel.IsUnique())
+		{
+			LastTreeModel = MakeShared<FSCSRuntimeEditorTreeModel>();
+		}
+		TreeModel = LastTreeModel;
+	}
+
+	GetInstancedComponentsForTree(InActorInstance, TreeModel->Components);
+	TreeModel->BuildEntries(InActorInstance);
+	TreeModel->Actor = InActorInstance;
+	TreeModel->NumActorComponents = InActorInstance->GetComponents().Num();
+	TreeModel->RootComponent = InActorInstance->GetRootComponent();
+	TreeModel->StructureHash = StructureHash;
+	TreeModel->bMerged = !bShared;
+
+	LastTreeModel = TreeModel;
+	bLastTreeModelCurrent = true;
+	if (bShared)
+	{
+		// Entries are only added on a miss, so the ones whose Actor is gone or that no tree holds on to any more are dropped here
+		for (auto It = SharedTreeModels.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid() || !It->Value.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		SharedTreeModels.Add(InActorInstance, TreeModel);
+	}
+
+	return TreeModel.ToSharedRef();
+}
+
+void SSCSRuntimeEditor::DeferChildActorTree(UChildActorComponent* InChildActorComponent)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_DeferChildActorTree);
+
+	check(InChildActorComponent != nullptr);
+
+	// Nested child actors are deferred below their own child actor component in turn, with no node built for any of them
+	TArray<UChildActorComponent*, TInlineAllocator<8>> ChildActorComponents;
+	ChildActorComponents.Add(InChildActorComponent);
+	if (!ChildActorTreeModel.IsValid())
+	{
+		ChildActorTreeModel = MakeShared<FSCSRuntimeEditorTreeModel>();
+	}
+	FSCSRuntimeEditorTreeModel& ChildActorModel = *ChildActorTreeModel;
+	bool bChildActorBuilt = false;
+
+	while (ChildActorComponents.Num() > 0)
+	{
+		UChildActorComponent* ChildActorComponent = ChildActorComponents.Pop(/*bAllowShrinking =*/false);
+		AActor* ChildActor = ChildActorComponent->GetChildActor();
+		if (ChildActor == nullptr || ChildActor->IsPendingKill())
+		{
+			continue;
+		}
+
+		ChildActorModel.Components.Reset();
+		for (UActorComponent* Component : ChildActor->GetComponents())
+		{
+			if (Component != nullptr && !Component->IsPendingKill())
+			{
+				ChildActorModel.Components.Add(Component);
+			}
+		}
+		ChildActorModel.BuildEntries(ChildActor);
+
+		for (const FSCSRuntimeEditorTreeModel::FEntry& Entry : ChildActorModel.Entries)
+		{
+			if (const UPrimitiveComponent* PrimComponent = Cast<UPrimitiveComponent>(Entry.Component))
+			{
+				ChildActorPrimitiveOwners.Add(PrimComponent, InChildActorComponent);
+			}
+
+			if (UChildActorComponent* NestedChildActorComponent = Cast<UChildActorComponent>(Entry.Component))
+			{
+				ChildActorComponents.Add(NestedChildActorComponent);
+			}
+
+			// Nodes already built (kept by a reconcile) follow the attachment inside the child actor, as the Actor's own nodes do: they
+			// move under the node of their current attach parent, or are dropped and deferred if that parent has no node. Parents come
+			// first in the model, so their nodes are in place already.
+			const UActorComponent* TreeParentComponent = Entry.ParentIndex != INDEX_NONE ? ChildActorModel.Entries[Entry.ParentIndex].Component : ChildActorComponent;
+			FSCSRuntimeEditorTreeNodePtrType NodePtr = ComponentToNodeIndex.FindRef(Entry.Component).Pin();
+			if (NodePtr.IsValid())
+			{
+				FSCSRuntimeEditorTreeNodePtrType ParentNodePtr = ComponentToNodeIndex.FindRef(TreeParentComponent).Pin();
+				if (!ParentNodePtr.IsValid())
+				{
+					if (SCSTreeWidget->IsItemSelected(NodePtr))
+					{
+						SCSTreeWidget->SetItemSelection(NodePtr, false);
+					}
+					if (NodePtr->GetParent().IsValid())
+					{
+						NodePtr->GetParent()->UnlinkChild(NodePtr);
+					}
+					ComponentToNodeIndex.Remove(Entry.Component);
+					NodePtr.Reset();
+				}
+				else if (NodePtr->GetParent() != ParentNodePtr)
+				{
+					if (NodePtr->GetParent().IsValid())
+					{
+						NodePtr->GetParent()->UnlinkChild(NodePtr);
+					}
+					ParentNodePtr->AddChild(NodePtr);
+				}
+			}
+
+			if (NodePtr.IsValid())
+			{
+				bChildActorBuilt |= ChildActorComponent == InChildActorComponent && Entry.ParentIndex == INDEX_NONE;
+			}
+			else
+			{
+				DeferTreeComponent(Entry.Component, TreeParentComponent);
+			}
+		}
+	}
+
+	// The child actor isn't shown until its component is expanded; nested ones are collapsed as their nodes are built
+	FSCSRuntimeEditorTreeNodePtrType NodePtr = ComponentToNodeIndex.FindRef(InChildActorComponent).Pin();
+	if (NodePtr.IsValid() && !bChildActorBuilt && HasDeferredChildren(NodePtr))
+	{
+		SCSTreeWidget->SetItemExpansion(NodePtr, false);
+	}
+}
+
+void SSCSRuntimeEditor::SetBaselineModeEnabled(bool bInEnabled)
+{
+	if (bBaselineModeEnabled != bInEnabled)
+	{
+		bBaselineModeEnabled = bInEnabled;
+		UpdateBaselineDiff();
+	}
+}
+
+void SSCSRuntimeEditor::OnPIEStarted(bool bIsSimulating)
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_CaptureBaselines);
+
+	// Every Actor in play is recorded as play starts, so that changes made before an Actor is first shown are reported too
+	Baselines.Reset();
+	if (bBaselineModeEnabled)
+	{
+		for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+		{
+			UWorld* World = WorldContext.World();
+			if (WorldContext.WorldType == EWorldType::PIE && World != nullptr)
+			{
+				for (TActorIterator<AActor> It(World); It; ++It)
+				{
+					CaptureActorBaseline(*It);
+				}
+			}
+		}
+	}
+
+	UpdateBaselineDiff();
+}
+
+SSCSRuntimeEditor::FBaselineComponentSignature SSCSRuntimeEditor::MakeBaselineSignature(const UActorComponent* InComponent)
+{
+	const USceneComponent* SceneComponent = Cast<USceneComponent>(InComponent);
+	const USceneComponent* AttachParent = SceneComponent != nullptr ? SceneComponent->GetAttachParent() : nullptr;
+
+	FBaselineComponentSignature Signature;
+	Signature.Name = InComponent->GetFName();
+	Signature.Class = InComponent->GetClass();
+	Signature.AttachParentName = AttachParent != nullptr ? AttachParent->GetFName() : NAME_None;
+	Signature.CreationMethod = InComponent->CreationMethod;
+	return Signature;
+}
+
+void SSCSRuntimeEditor::CaptureActorBaseline(AActor* InActor)
+{
+	TArray<FBaselineComponentSignature>& Baseline = Baselines.FindOrAdd(InActor);
+	Baseline.Reset(InActor->GetComponents().Num());
+	for (const UActorComponent* Component : InActor->GetComponents())
+	{
+		if (Component != nullptr && !Component->IsPendingKill())
+		{
+			Baseline.Add(MakeBaselineSignature(Component));
+		}
+	}
+}
+
+void SSCSRuntimeEditor::CaptureBaseline()
+{
+	if (const AActor* ActorInstance = GetActorContext())
+	{
+		CaptureActorBaseline(ActorInstance);
+	}
+
+	UpdateBaselineDiff();
+}
+
+void SSCSRuntimeEditor::UpdateBaselineDiff()
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_UpdateBaselineDiff);
+
+	CompareAgainstBaseline();
+
+	// The rows show what was found until the next comparison, rather than looking it up on every paint
+	ForEachGeneratedRow([](SSCS_RuntimeRowWidget& RowWidget)
+	{
+		RowWidget.UpdateBaselineBadge();
+	});
+}
+
+void SSCSRuntimeEditor::ForEachGeneratedRow(TFunctionRef<void(SSCS_RuntimeRowWidget&)> InFunction)
+{
+	for (int32 RowIndex = GeneratedRows.Num() - 1; RowIndex >= 0; --RowIndex)
+	{
+		TSharedPtr<SSCS_RuntimeRowWidget> RowWidget = GeneratedRows[RowIndex].Pin();
+		if (RowWidget.IsValid())
+		{
+			InFunction(*RowWidget);
+		}
+		else
+		{
+			GeneratedRows.RemoveAtSwap(RowIndex, 1, /*bAllowShrinking =*/false);
+		}
+	}
+}
+
+EActiveTimerReturnType SSCSRuntimeEditor::RevalidateGeneratedRows(double InCurrentTime, float InDeltaTime)
+{
+	ForEachGeneratedRow([](SSCS_RuntimeRowWidget& RowWidget)
+	{
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = RowWidget.GetNode();
+		if (NodePtr.IsValid() && NodePtr->GetComponentTemplate() != nullptr)
+		{
+			NodePtr->RevalidateRowViewModel();
+		}
+	});
+
+	return EActiveTimerReturnType::Continue;
+}
+
+void SSCSRuntimeEditor::CompareAgainstBaseline()
+{
+	BaselineDiffs.Reset();
+	NumDestroyedUnderActorNode = 0;
+
+	AActor* ActorInstance = GetActorContext();
+	if (!bBaselineModeEnabled || ActorInstance == nullptr)
+	{
+		return;
+	}
+
+	const TArray<FBaselineComponentSignature>* Baseline = Baselines.Find(ActorInstance);
+	if (Baseline == nullptr)
+	{
+		// An Actor that wasn't in play when it started is recorded the first time it is shown, so there is nothing to compare yet;
+		// the baselines of Actors that are gone won't be compared against again
+		for (auto It = Baselines.CreateIterator(); It; ++It)
+		{
+			if (!It->Key.IsValid())
+			{
+				It.RemoveCurrent();
+			}
+		}
+
+		CaptureActorBaseline(ActorInstance);
+		return;
+	}
+
+	// Components are matched by name, which is unique within the Actor, so the comparison is a single pass over each side
+	BaselineDiffIndices.Reset();
+	for (int32 BaselineIndex = 0; BaselineIndex < Baseline->Num(); ++BaselineIndex)
+	{
+		BaselineDiffIndices.Add((*Baseline)[BaselineIndex].Name, BaselineIndex);
+	}
+	BaselineDiffMatched.Init(false, Baseline->Num());
+	BaselineDiffComponents.Reset();
+
+	for (const UActorComponent* Component : ActorInstance->GetComponents())
+	{
+		if (Component == nullptr || Component->IsPendingKill())
+		{
+			continue;
+		}
+
+		const FBaselineComponentSignature Signature = MakeBaselineSignature(Component);
+		BaselineDiffComponents.Add(Signature.Name, Component);
+
+		// A component that took the name of a destroyed one is a new component
+		const int32* BaselineIndex = BaselineDiffIndices.Find(Signature.Name);
+		const FBaselineComponentSignature* BaselineSignature = BaselineIndex != nullptr ? &(*Baseline)[*BaselineIndex] : nullptr;
+		if (BaselineSignature == nullptr || BaselineSignature->Class != Signature.Class || BaselineSignature->CreationMethod != Signature.CreationMethod)
+		{
+			BaselineDiffs.FindOrAdd(Component).Change = ESCSRuntimeBaselineChange::Added;
+			continue;
+		}
+
+		BaselineDiffMatched[*BaselineIndex] = true;
+		if (BaselineSignature->AttachParentName != Signature.AttachParentName)
+		{
+			BaselineDiffs.FindOrAdd(Component).Change = ESCSRuntimeBaselineChange::Reattached;
+		}
+	}
+
+	// The components of the baseline that weren't matched were destroyed; they are counted on their former parent's row if it is
+	// still there, and on the Actor's otherwise
+	for (int32 BaselineIndex = 0; BaselineIndex < Baseline->Num(); ++BaselineIndex)
+	{
+		if (!BaselineDiffMatched[BaselineIndex])
+		{
+			const UActorComponent* const* FormerParent = BaselineDiffComponents.Find((*Baseline)[BaselineIndex].AttachParentName);
+			if (FormerParent != nullptr)
+			{
+				++BaselineDiffs.FindOrAdd(*FormerParent).NumDestroyedChildren;
+			}
+			else
+			{
+				++NumDestroyedUnderActorNode;
+			}
+		}
+	}
+
+	BaselineDiffComponents.Reset();
+}
+
+bool SSCSRuntimeEditor::GetBaselineDiff(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr, ESCSRuntimeBaselineChange& OutChange, int32& OutNumDestroyedChildren) const
+{
+	OutChange = ESCSRuntimeBaselineChange::None;
+	OutNumDestroyedChildren = 0;
+
+	if (!bBaselineModeEnabled || !InNodePtr.IsValid())
+	{
+		return false;
+	}
+
+	if (InNodePtr->GetNodeType() == FSCSRuntimeEditorTreeNode::RootActorNode)
+	{
+		OutNumDestroyedChildren = NumDestroyedUnderActorNode;
+	}
+	else if (const FBaselineComponentDiff* Diff = BaselineDiffs.Find(InNodePtr->GetComponentTemplate()))
+	{
+		OutChange = Diff->Change;
+		OutNumDestroyedChildren = Diff->NumDestroyedChildren;
+	}
+
+	return OutChange != ESCSRuntimeBaselineChange::None || OutNumDestroyedChildren > 0;
+}
+
+ECheckBoxState SSCSRuntimeEditor::GetBaselineModeCheckState() const
+{
+	return bBaselineModeEnabled ? ECheckBoxState::Checked : ECheckBoxState::Unchecked;
+}
+
+void SSCSRuntimeEditor::OnBaselineModeCheckStateChanged(ECheckBoxState InState)
+{
+	SetBaselineModeEnabled(InState == ECheckBoxState::Checked);
+}
+
+EVisibility SSCSRuntimeEditor::GetRecaptureBaselineVisibility() const
+{
+	return bBaselineModeEnabled ? EVisibility::Visible : EVisibility::Collapsed;
+}
+
+FReply SSCSRuntimeEditor::OnRecaptureBaselineClicked()
+{
+	CaptureBaseline();
+	return FReply::Handled();
+}
+
+/** Identifies matching components across merged Actors */
+struct FMergedComponentKey
+{
+	FName Name;
+	const UClass* Class;
+
+	FMergedComponentKey(FName InName, const UClass* InClass)
+		: Name(InName)
+		, Class(InClass)
+	{
+	}
+
+	bool operator==(const FMergedComponentKey& Other) const
+	{
+		return Name == Other.Name && Class == Other.Class;
+	}
+
+	friend uint32 GetTypeHash(const FMergedComponentKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Name), GetTypeHash(Key.Class));
+	}
+};
+
+void SSCSRuntimeEditor::MergeInstancedComponents(AActor* InActorInstance, TSet<UActorComponent*>& InOutComponents)
+{
+	MergedComponentInstances.Reset();
+
+	if (MergedActors.Num() == 0)
+	{
+		return;
+	}
+
+	// Components without a name match fall back to a class match, as long as the class is unique on both sides
+	TMap<const UClass*, int32> ClassCounts;
+	for (UActorComponent* Component : InOutComponents)
+	{
+		++ClassCounts.FindOrAdd(Component->GetClass());
+	}
+
+	MergedComponentInstances.Reserve(InOutComponents.Num());
+	for (UActorComponent* Component : InOutComponents)
+	{
+		MergedComponentInstances.Add(Component).Reserve(MergedActors.Num());
+	}
+
+	// Each merged Actor is hashed once and every remaining component is matched against it, so the cost is linear in the total number of components
+	TMap<FMergedComponentKey, UActorComponent*> ComponentsByName;
+	TMap<const UClass*, UActorComponent*> ComponentsByUniqueClass;
+	for (const TWeakObjectPtr<AActor>& MergedActorPtr : MergedActors)
+	{
+		AActor* MergedActor = MergedActorPtr.Get();
+		if (MergedActor == nullptr || MergedActor == InActorInstance || MergedActor->IsPendingKill())
+		{
+			continue;
+		}
+
+		ComponentsByName.Reset();
+		ComponentsByUniqueClass.Reset();
+		for (UActorComponent* MergedComponent : MergedActor->GetComponents())
+		{
+			if (MergedComponent != nullptr && !MergedComponent->IsPendingKill())
+			{
+				ComponentsByName.Add(FMergedComponentKey(MergedComponent->GetFName(), MergedComponent->GetClass()), MergedComponent);
+
+				// A class seen more than once can't be matched by class alone
+				if (UActorComponent** ExistingComponent = ComponentsByUniqueClass.Find(MergedComponent->GetClass()))
+				{
+					*ExistingComponent = nullptr;
+				}
+				else
+				{
+					ComponentsByUniqueClass.Add(MergedComponent->GetClass(), MergedComponent);
+				}
+			}
+		}
+
+		for (auto It = InOutComponents.CreateIterator(); It; ++It)
+		{
+			UActorComponent* Component = *It;
+
+			// The root is always kept so the tree keeps its shape, and is merged with the other roots
+			if (Component == InActorInstance->GetRootComponent())
+			{
+				if (USceneComponent* MergedRootComponent = MergedActor->GetRootComponent())
+				{
+					MergedComponentInstances.FindChecked(Component).Add(MergedRootComponent);
+				}
+				continue;
+			}
+
+			UActorComponent* MergedComponent = ComponentsByName.FindRef(FMergedComponentKey(Component->GetFName(), Component->GetClass()));
+			if (MergedComponent == nullptr && ClassCounts.FindRef(Component->GetClass()) == 1)
+			{
+				MergedComponent = ComponentsByUniqueClass.FindRef(Component->GetClass());
+			}
+
+			if (MergedComponent != nullptr)
+			{
+				MergedComponentInstances.FindChecked(Component).Add(MergedComponent);
+			}
+			else
+			{
+				MergedComponentInstances.Remove(Component);
+				It.RemoveCurrent();
+			}
+		}
+	}
+}
+
+int32 SSCSRuntimeEditor::GetNumMergedActors() const
+{
+	int32 NumMergedActors = 0;
+	for (const TWeakObjectPtr<AActor>& MergedActor : MergedActors)
+	{
+		if (MergedActor.IsValid())
+		{
+			++NumMergedActors;
+		}
+	}
+	return NumMergedActors;
+}
+
+bool SSCSRuntimeEditor::SetMergedActors(const TArray<AActor*>& InActors)
+{
+	bool bChanged = InActors.Num() != MergedActors.Num();
+	for (int32 ActorIndex = 0; !bChanged && ActorIndex < InActors.Num(); ++ActorIndex)
+	{
+		bChanged = MergedActors[ActorIndex].Get() != InActors[ActorIndex];
+	}
+
+	if (bChanged)
+	{
+		MergedActors.Reset(InActors.Num());
+		for (AActor* Actor : InActors)
+		{
+			MergedActors.Add(Actor);
+		}
+	}
+
+	return bChanged;
+}
+
+void SSCSRuntimeEditor::AppendMergedObjects(TArray<UObject*>& InOutObjects) const
+{
+	if (MergedActors.Num() == 0)
+	{
+		return;
+	}
+
+	AActor* ActorInstance = GetActorContext();
+
+	const int32 NumObjects = InOutObjects.Num();
+	for (int32 ObjectIndex = 0; ObjectIndex < NumObjects; ++ObjectIndex)
+	{
+		UObject* Object = InOutObjects[ObjectIndex];
+		if (Object != nullptr && Object == ActorInstance)
+		{
+			for (const TWeakObjectPtr<AActor>& MergedActor : MergedActors)
+			{
+				if (MergedActor.IsValid() && MergedActor.Get() != ActorInstance)
+				{
+					InOutObjects.Add(MergedActor.Get());
+				}
+			}
+		}
+		else if (const TArray<TWeakObjectPtr<UActorComponent>>* MergedInstances = MergedComponentInstances.Find(Cast<UActorComponent>(Object)))
+		{
+			for (const TWeakObjectPtr<UActorComponent>& MergedInstance : *MergedInstances)
+			{
+				if (MergedInstance.IsValid())
+				{
+					InOutObjects.Add(MergedInstance.Get());
+				}
+			}
+		}
+	}
+}
+
+bool SSCSRuntimeEditor::ReconcileInstancedTreeNodes()
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_ReconcileTree);
+
+	check(EditorMode == EComponentEditorMode::ActorInstance);
+
+	AActor* ActorInstance = GetActorContext();
+	FSCSRuntimeEditorActorNodePtrType ActorNode = GetActorNode();
+	if (ActorInstance == nullptr || !ActorNode.IsValid() || ActorNode->GetActor() != ActorInstance)
+	{
+		return false;
+	}
+
+	// A change of root component moves the separators and the scene root around; leave that (rare) case to a full rebuild
+	USceneComponent* RootComponent = ActorInstance->GetRootComponent();
+	FSCSRuntimeEditorTreeNodePtrType SceneRootNode = ActorNode->GetSceneRootNode();
+	if ((SceneRootNode.IsValid() ? SceneRootNode->GetComponentTemplate() : nullptr) != RootComponent)
+	{
+		return false;
+	}
+
+	// Index the nodes that are currently in the tree by the component they represent. This and the containers below are members,
+	// so that once they have grown to fit the Actor, a reconcile only allocates the nodes it adds.
+	TArray<FSCSRuntimeEditorTreeNodePtrType>& ExistingNodes = ReconcileExistingNodes;
+	TMap<const UActorComponent*, FSCSRuntimeEditorTreeNodePtrType>& ExistingNodeMap = ReconcileExistingNodeMap;
+	TArray<FSCSRuntimeEditorTreeNodePtrType>& ChildActorNodes = ReconcileChildActorNodes;
+	{
+		TArray<FSCSRuntimeEditorTreeNodePtrType>& NodeStack = ReconcileNodeStack;
+		NodeStack.Append(ActorNode->GetChildren());
+		while (NodeStack.Num() > 0)
+		{
+			FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+			if (NodePtr->GetNodeType() == FSCSRuntimeEditorTreeNode::ComponentNode)
+			{
+				const UActorComponent* Component = NodePtr->GetComponentTemplate();
+				if (Component != nullptr && Component->GetOwner() != ActorInstance)
+				{
+					// The nodes built for child actors stay where they are, below their child actor component
+					ChildActorNodes.Add(NodePtr);
+				}
+				else
+				{
+					ExistingNodes.Add(NodePtr);
+					if (Component != nullptr)
+					{
+						ExistingNodeMap.Add(Component, NodePtr);
+					}
+				}
+			}
+			NodeStack.Append(NodePtr->GetChildren());
+		}
+	}
+
+	TSharedRef<const FSCSRuntimeEditorTreeModel> TreeModel = GetTreeModel(ActorInstance);
+	const TSet<UActorComponent*>& ComponentsToAdd = TreeModel->Components;
+
+	// Place each component under the node that matches its current attach parent, creating the node if it is new. Parents
+	// are resolved first so a whole newly attached subtree can be added in one pass.
+	TMap<const UActorComponent*, FSCSRuntimeEditorTreeNodePtrType>& ReconciledNodeMap = ReconcileReconciledNodeMap;
+	ReconciledNodeMap.Reserve(ComponentsToAdd.Num());
+
+	// Nodes whose children weren't built yet keep them deferred, along with any new ones. Their lists are emptied rather than
+	// removed, so that the parent stays marked as deferred and the list keeps its memory; those left empty are dropped below.
+	for (TPair<TWeakObjectPtr<const UActorComponent>, TArray<TWeakObjectPtr<UActorComponent>>>& DeferredChildren : DeferredChildComponents)
+	{
+		DeferredChildren.Value.Reset();
+	}
+	DeferredTreeParents.Reset();
+	ChildActorPrimitiveOwners.Reset();
+
+	// The attach parent whose node a scene component is shown under, if that parent is represented in the tree as well
+	auto GetTreeAttachParent = [ActorInstance, RootComponent, &ComponentsToAdd](UActorComponent* Component) -> USceneComponent*
+	{
+		USceneComponent* SceneComponent = Cast<USceneComponent>(Component);
+		USceneComponent* AttachParent = SceneComponent != nullptr && SceneComponent != RootComponent ? SceneComponent->GetAttachParent() : nullptr;
+		return AttachParent != nullptr && AttachParent->GetOwner() == ActorInstance && ComponentsToAdd.Contains(AttachParent) ? AttachParent : nullptr;
+	};
+
+	// Reconciles the node of a single component; the node of its attach parent must have been reconciled already
+	auto ReconcileComponentNode = [&](UActorComponent* Component)
+	{
+		FSCSRuntimeEditorTreeNodePtrType ParentNodePtr = ActorNode;
+		const UActorComponent* TreeParentComponent = nullptr;
+		if (USceneComponent* AttachParent = GetTreeAttachParent(Component))
+		{
+			ParentNodePtr = ReconciledNodeMap.FindChecked(AttachParent);
+			TreeParentComponent = AttachParent;
+		}
+		else if (Component != RootComponent && Component->IsA<USceneComponent>() && SceneRootNode.IsValid())
+		{
+			ParentNodePtr = SceneRootNode;
+			TreeParentComponent = RootComponent;
+		}
+
+		// Below a node that isn't built, or whose children aren't, the node stays deferred (and an existing one is dropped)
+		if (TreeParentComponent != nullptr && (!ParentNodePtr.IsValid() || DeferredChildComponents.Contains(TreeParentComponent)))
+		{
+			DeferTreeComponent(Component, TreeParentComponent);
+			ReconciledNodeMap.Add(Component, FSCSRuntimeEditorTreeNodePtrType());
+			return;
+		}
+
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = ExistingNodeMap.FindRef(Component);
+		if (!NodePtr.IsValid())
+		{
+			NodePtr = FSCSRuntimeEditorTreeNode::FactoryNodeFromComponent(Component);
+			ParentNodePtr->AddChild(NodePtr);
+			RefreshFilteredState(NodePtr, false);
+			SCSTreeWidget->SetItemExpansion(NodePtr, true);
+		}
+		else
+		{
+			// The component may have been renamed along with whatever else changed
+			NodePtr->InvalidateFilterKey();
+			NodePtr->RevalidateRowViewModel();
+
+			if (NodePtr->GetParent() != ParentNodePtr)
+			{
+				if (NodePtr->GetParent().IsValid())
+				{
+					NodePtr->GetParent()->UnlinkChild(NodePtr);
+				}
+				ParentNodePtr->AddChild(NodePtr);
+			}
+		}
+
+		ReconciledNodeMap.Add(Component, NodePtr);
+	};
+
+	// Walks up the attach parents to the first one that is reconciled already, then reconciles back down from there, so that
+	// parents always come before their children without recursing
+	TArray<UActorComponent*>& ComponentStack = ReconcileComponentStack;
+	auto ReconcileAttachedComponentNode = [&](UActorComponent* Component)
+	{
+		for (UActorComponent* PendingComponent = Component; PendingComponent != nullptr && !ReconciledNodeMap.Contains(PendingComponent); PendingComponent = GetTreeAttachParent(PendingComponent))
+		{
+			ComponentStack.Push(PendingComponent);
+		}
+
+		while (ComponentStack.Num() > 0)
+		{
+			ReconcileComponentNode(ComponentStack.Pop(/*bAllowShrinking =*/false));
+		}
+	};
+
+	if (RootComponent != nullptr && ComponentsToAdd.Contains(RootComponent))
+	{
+		ReconcileAttachedComponentNode(RootComponent);
+	}
+
+	// Always put scene components first in the tree, followed by any non-scene components
+	for (UActorComponent* Component : ComponentsToAdd)
+	{
+		if (Component->IsA<USceneComponent>())
+		{
+			ReconcileAttachedComponentNode(Component);
+		}
+	}
+
+	for (UActorComponent* Component : ComponentsToAdd)
+	{
+		if (!Component->IsA<USceneComponent>())
 		{
-			// Look for a component match in the new hierarchy; if found, mark it as collapsed to match the previous setting
-			FSCSRuntimeEditorTreeNodePtrType NodeToExpandPtr = FindTreeNode(CollapsedTreeNodeArray[i]->GetComponentTemplate());
-			if(NodeToExpandPtr.IsValid())
-			{
-				SCSTreeWidget->SetItemExpansion(NodeToExpandPtr, false);
-			}
+			ReconcileAttachedComponentNode(Component);
 		}
+	}
 
-		if(SelectedTreeNodes.Num() > 0)
+	// Drop any nodes whose component no longer exists (or is no longer represented by that node)
+	bool bRemovedSelectedNode = false;
+	for (const FSCSRuntimeEditorTreeNodePtrType& NodePtr : ExistingNodes)
+	{
+		if (ReconciledNodeMap.FindRef(NodePtr->GetComponentTemplate()) != NodePtr)
 		{
-			// Restore the previous selection state on the new tree nodes
-			for (int i = 0; i < SelectedTreeNodes.Num(); ++i)
+			if (SCSTreeWidget->IsItemSelected(NodePtr))
 			{
-				if (SelectedTreeNodes[i]->GetNodeType() == FSCSRuntimeEditorTreeNode::RootActorNode)
-				{
-					SCSTreeWidget->SetItemSelection(ActorTreeNode, true);
-				}
-				else
-				{
-					FSCSRuntimeEditorTreeNodePtrType NodeToSelectPtr = FindTreeNode(SelectedTreeNodes[i]->GetComponentTemplate());
-					if (NodeToSelectPtr.IsValid())
-					{
-						SCSTreeWidget->SetItemSelection(NodeToSelectPtr, true);
-					}
-				}
+				SCSTreeWidget->SetItemSelection(NodePtr, false);
+				bRemovedSelectedNode = true;
 			}
 
-			if (GetEditorMode() != EComponentEditorMode::BlueprintSCS)
+			if (NodePtr->GetParent().IsValid())
 			{
-				TArray<FSCSRuntimeEditorTreeNodePtrType> NewSelectedTreeNodes = SCSTreeWidget->GetSelectedItems();
-				if (NewSelectedTreeNodes.Num() == 0)
-				{
-					SCSTreeWidget->SetItemSelection(GetRootNodes()[0], true);
-				}
+				NodePtr->GetParent()->UnlinkChild(NodePtr);
 			}
 		}
+	}
+
+	if (bRemovedSelectedNode && SCSTreeWidget->GetNumItemsSelected() == 0)
+	{
+		SCSTreeWidget->SetItemSelection(ActorNode, true);
+	}
+
+	ComponentToNodeIndex.Reset();
+	for (const TPair<const UActorComponent*, FSCSRuntimeEditorTreeNodePtrType>& ReconciledNode : ReconciledNodeMap)
+	{
+		if (ReconciledNode.Value.IsValid())
+		{
+			ComponentToNodeIndex.Add(ReconciledNode.Key, ReconciledNode.Value);
+		}
+	}
+	for (const FSCSRuntimeEditorTreeNodePtrType& NodePtr : ChildActorNodes)
+	{
+		if (NodePtr->IsAttachedTo(ActorNode))
+		{
+			// As for the Actor's own nodes, the component may have been renamed or changed along with whatever else changed
+			NodePtr->InvalidateFilterKey();
+			NodePtr->RevalidateRowViewModel();
+			IndexTreeNode(NodePtr);
+		}
+	}
 
-		// If we have a pending deferred rename request, redirect it to the new tree node
-		if(DeferredRenameRequest != NAME_None)
+	// The parts of the child actors that aren't built yet, including any new components, are deferred again, and the nodes that
+	// are built are moved under the node of their current attach parent
+	for (UActorComponent* Component : ComponentsToAdd)
+	{
+		if (UChildActorComponent* ChildActorComponent = Cast<UChildActorComponent>(Component))
 		{
-			FSCSRuntimeEditorTreeNodePtrType NodeToRenamePtr = FindTreeNode(DeferredRenameRequest);
-			if(NodeToRenamePtr.IsValid())
-			{
-				SCSTreeWidget->RequestScrollIntoView(NodeToRenamePtr);
-			}
+			DeferChildActorTree(ChildActorComponent);
 		}
 	}
 
-	// refresh widget
-	SCSTreeWidget->RequestTreeRefresh();
+	for (auto It = DeferredChildComponents.CreateIterator(); It; ++It)
+	{
+		if (It->Value.Num() == 0)
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Release the node references, but keep the memory
+	ExistingNodes.Reset();
+	ExistingNodeMap.Reset();
+	ReconciledNodeMap.Reset();
+	ChildActorNodes.Reset();
+
+	SCSNodeToNodeIndex.Reset();
+	NameToNodeIndex.Reset();
+	bTreeNodeIndexComplete = true;
+	bNameIndexComplete = false;
+
+	// If we have a pending deferred rename request, make sure the node is brought into view
+	if (DeferredRenameRequest != NAME_None)
+	{
+		FSCSRuntimeEditorTreeNodePtrType NodeToRenamePtr = FindTreeNode(DeferredRenameRequest);
+		if (NodeToRenamePtr.IsValid())
+		{
+			SCSTreeWidget->RequestScrollIntoView(NodeToRenamePtr);
+		}
+	}
+
+	return true;
 }
 
 void SSCSRuntimeEditor::DumpTree()
@@ -5468,8 +7030,8 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::FindOrCreateParentForExistin
 	if (SceneComponent->GetAttachParent() != nullptr
 		&& (EditorMode != EComponentEditorMode::ActorInstance || SceneComponent->GetAttachParent()->GetOwner() == GetActorContext()))
 	{
-		// Attempt to find the parent node in the current tree
-		ParentNodePtr = FindTreeNode(SceneComponent->GetAttachParent());
+		// Attempt to find the parent node in the current tree, building it if it was deferred
+		ParentNodePtr = MaterializeDeferredComponent(SceneComponent->GetAttachParent());
 		if (!ParentNodePtr.IsValid())
 {
 			// If the actual attach parent wasn't found, attempt to find its archetype.
@@ -5636,9 +7198,33 @@ UActorComponent* SSCSRuntimeEditor::AddNewNodeForInstancedComponent(TUniquePtr<F
 
 bool SSCSRuntimeEditor::IsComponentSelected(const UPrimitiveComponent* PrimComponent) const
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_IsComponentSelected);
+
 	check(PrimComponent);
 
-	if (SCSTreeWidget.IsValid())
+	if (SCSTreeWidget.IsValid() && EditorMode == EComponentEditorMode::ActorInstance)
+	{
+		// The renderer calls this per primitive whenever selection is pushed to the proxies, so answer from the cached set
+		const TSet<const UActorComponent*>& SelectedComponents = GetSelectedComponentCache();
+		if (SelectedComponents.Contains(PrimComponent))
+		{
+			return true;
+		}
+
+		// Primitives owned by a child actor are also selected through the outermost child actor component, mapped when the tree was
+		// built. A child actor respawned, or given a new primitive, since then isn't mapped yet, so a miss falls back to its owners.
+		const UChildActorComponent* PossiblySelectedComponent = ChildActorPrimitiveOwners.FindRef(PrimComponent);
+		if (PossiblySelectedComponent == nullptr)
+		{
+			for (AActor* ComponentOwner = PrimComponent->GetOwner(); ComponentOwner != nullptr && ComponentOwner->IsChildActor(); ComponentOwner = ComponentOwner->GetParentActor())
+			{
+				PossiblySelectedComponent = ComponentOwner->GetParentComponent();
+			}
+		}
+
+		return PossiblySelectedComponent != nullptr && SelectedComponents.Contains(PossiblySelectedComponent);
+	}
+	else if (SCSTreeWidget.IsValid())
 	{
 		FSCSRuntimeEditorTreeNodePtrType NodePtr = GetNodeFromActorComponent(PrimComponent, false);
 		if (NodePtr.IsValid())
@@ -5669,6 +7255,28 @@ bool SSCSRuntimeEditor::IsComponentSelected(const UPrimitiveComponent* PrimCompo
 	return false;
 }
 
+const TSet<const UActorComponent*>& SSCSRuntimeEditor::GetSelectedComponentCache() const
+{
+	if (CachedSelectionGeneration != SelectionGeneration)
+	{
+		SelectedComponentCache.Reset();
+		for (const FSCSRuntimeEditorTreeNodePtrType& SelectedNodePtr : SCSTreeWidget->GetSelectedItems())
+		{
+			if (SelectedNodePtr.IsValid())
+			{
+				if (const UActorComponent* Component = SelectedNodePtr->GetComponentTemplate())
+				{
+					SelectedComponentCache.Add(Component);
+				}
+			}
+		}
+
+		CachedSelectionGeneration = SelectionGeneration;
+	}
+
+	return SelectedComponentCache;
+}
+
 void SSCSRuntimeEditor::SetSelectionOverride(UPrimitiveComponent* PrimComponent) const
 {
 	PrimComponent->SelectionOverrideDelegate = UPrimitiveComponent::FSelectionOverride::CreateSP(this, &SSCSRuntimeEditor::IsComponentSelected);
@@ -6000,17 +7608,19 @@ void SSCSRuntimeEditor::OnDeleteNodes()
 		int32 NumDeletedComponents = FRuntimeDetailsEditorUtils::DeleteComponents(ComponentsToDelete, ComponentToSelect);
 		if (NumDeletedComponents > 0)
 		{
+			// Update the tree once for the whole batch, which drops the deleted nodes, then select the survivor in the updated tree
+			UpdateTree();
+
 			if (ComponentToSelect)
 			{
 				FSCSRuntimeEditorTreeNodePtrType NodeToSelect = GetNodeFromActorComponent(ComponentToSelect);
 				if (NodeToSelect.IsValid())
 				{
+					// Selecting it notifies the selection change, which the call below would only repeat
 					SCSTreeWidget->SetSelection(NodeToSelect);
+					return;
 				}
 			}
-
-			// Rebuild the tree view to reflect the new component hierarchy
-			UpdateTree();
 		}
 	}
 
@@ -6022,6 +7632,8 @@ void SSCSRuntimeEditor::RemoveComponentNode(FSCSRuntimeEditorTreeNodePtrType InN
 {
 	check(InNodePtr.IsValid());
 
+	UnindexTreeNode(InNodePtr);
+
 	if (EditorMode == EComponentEditorMode::BlueprintSCS)
 	{
 		USCS_Node* SCS_Node = InNodePtr->GetSCSNode();
@@ -6105,6 +7717,8 @@ void SSCSRuntimeEditor::RemoveComponentNode(FSCSRuntimeEditorTreeNodePtrType InN
 
 void SSCSRuntimeEditor::UpdateSelectionFromNodes(const TArray<FSCSRuntimeEditorTreeNodePtrType> &SelectedNodes)
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_UpdateSelectionFromNodes);
+
 	bUpdatingSelection = true;
 
 	// Notify that the selection has updated
@@ -6120,6 +7734,8 @@ void SSCSRuntimeEditor::RefreshSelectionDetails()
 
 void SSCSRuntimeEditor::OnTreeSelectionChanged(FSCSRuntimeEditorTreeNodePtrType, ESelectInfo::Type /*SelectInfo*/)
 {
+	++SelectionGeneration;
+
 	UpdateSelectionFromNodes(SCSTreeWidget->GetSelectedItems());
 }
 
@@ -6163,6 +7779,7 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::AddTreeNode(USCS_Node* InSCS
 	// do this first, because we need a FSCSRuntimeEditorTreeNodePtrType for the new node
 	NewNodePtr = InParentNodePtr->AddChild(InSCSNode, bIsInheritedSCS);
 	RefreshFilteredState(NewNodePtr, /*bRecursive =*/false);
+	IndexTreeNode(NewNodePtr);
 	
 	if( InSCSNode->ComponentTemplate && 
 		InSCSNode->ComponentTemplate->IsA(USceneComponent::StaticClass()) && 
@@ -6226,6 +7843,7 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::AddTreeNodeFromComponent(UAc
 		NewNodePtr = FSCSRuntimeEditorTreeNode::FactoryNodeFromComponent(InActorComponent);
 		InParentTreeNode->AddChild(NewNodePtr);
 		RefreshFilteredState(NewNodePtr, false);
+		IndexTreeNode(NewNodePtr);
 	}
 
 	SCSTreeWidget->SetItemExpansion(NewNodePtr, true);
@@ -6233,6 +7851,107 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::AddTreeNodeFromComponent(UAc
 	return NewNodePtr;
 }
 
+/**
+ * Looks up a tree node in one of the node lookup tables. Entries that no longer represent the key are discarded; entries that
+ * are not (or no longer) reachable from the given start node are treated as a miss.
+ */
+template<typename KeyType, typename PredicateType>
+static FSCSRuntimeEditorTreeNodePtrType FindIndexedTreeNode(TMap<KeyType, TWeakPtr<FSCSRuntimeEditorTreeNode>>& InIndex, const KeyType& InKey, const FSCSRuntimeEditorTreeNodePtrType& InStartNodePtr, const PredicateType& IsMatch)
+{
+	FSCSRuntimeEditorTreeNodePtrType NodePtr;
+	if (const TWeakPtr<FSCSRuntimeEditorTreeNode>* IndexedNodePtr = InIndex.Find(InKey))
+	{
+		NodePtr = IndexedNodePtr->Pin();
+		if (!NodePtr.IsValid() || !IsMatch(NodePtr))
+		{
+			InIndex.Remove(InKey);
+			NodePtr.Reset();
+		}
+		else if (NodePtr != InStartNodePtr && !NodePtr->IsAttachedTo(InStartNodePtr))
+		{
+			NodePtr.Reset();
+		}
+	}
+
+	return NodePtr;
+}
+
+bool SSCSRuntimeEditor::CanUseTreeNodeIndex(const FSCSRuntimeEditorTreeNodePtrType& InStartNodePtr) const
+{
+	// Blueprint mode can also match on inherited component overrides, which the tables don't track
+	return EditorMode == EComponentEditorMode::ActorInstance
+		&& (InStartNodePtr == GetActorNode() || InStartNodePtr == GetSceneRootNode());
+}
+
+void SSCSRuntimeEditor::IndexTreeNode(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) const
+{
+	if (const UActorComponent* ComponentTemplate = InNodePtr->GetComponentTemplate())
+	{
+		ComponentToNodeIndex.Add(ComponentTemplate, InNodePtr);
+	}
+
+	if (const USCS_Node* SCS_Node = InNodePtr->GetSCSNode())
+	{
+		SCSNodeToNodeIndex.Add(SCS_Node, InNodePtr);
+	}
+}
+
+void SSCSRuntimeEditor::UnindexTreeNode(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr)
+{
+	if (const UActorComponent* ComponentTemplate = InNodePtr->GetComponentTemplate(/*bEvenIfPendingKill =*/true))
+	{
+		ComponentToNodeIndex.Remove(ComponentTemplate);
+	}
+
+	if (const USCS_Node* SCS_Node = InNodePtr->GetSCSNode())
+	{
+		SCSNodeToNodeIndex.Remove(SCS_Node);
+	}
+
+	for (const FSCSRuntimeEditorTreeNodePtrType& ChildNodePtr : InNodePtr->GetChildren())
+	{
+		UnindexTreeNode(ChildNodePtr);
+	}
+}
+
+void SSCSRuntimeEditor::RebuildTreeNodeIndex(bool bIncludeNodeNames) const
+{
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_RebuildNodeIndex);
+
+	ComponentToNodeIndex.Reset();
+	SCSNodeToNodeIndex.Reset();
+	if (bIncludeNodeNames)
+	{
+		NameToNodeIndex.Reset();
+	}
+
+	TArray<FSCSRuntimeEditorTreeNodePtrType, TInlineAllocator<64>> NodeStack;
+	NodeStack.Append(RootNodes);
+	while (NodeStack.Num() > 0)
+	{
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+		IndexTreeNode(NodePtr);
+
+		if (bIncludeNodeNames && NodePtr->GetNodeType() != FSCSRuntimeEditorTreeNode::SeparatorNode)
+		{
+			const FName NodeID = NodePtr->GetNodeID();
+			if (NodeID != NAME_None && !NameToNodeIndex.Contains(NodeID))
+			{
+				NameToNodeIndex.Add(NodeID, NodePtr);
+			}
+		}
+
+		NodeStack.Append(NodePtr->GetChildren());
+	}
+
+	bTreeNodeIndexComplete = true;
+	if (bIncludeNodeNames)
+	{
+		bNameIndexComplete = true;
+		NameIndexStructureGeneration = GetTreeStructureGeneration();
+	}
+}
+
 FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::FindTreeNode(const USCS_Node* InSCSNode, FSCSRuntimeEditorTreeNodePtrType InStartNodePtr) const
 {
 	FSCSRuntimeEditorTreeNodePtrType NodePtr;
@@ -6244,7 +7963,18 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::FindTreeNode(const USCS_Node
 			InStartNodePtr = GetSceneRootNode();
 		}
 
-		if(InStartNodePtr.IsValid())
+		if(InStartNodePtr.IsValid() && CanUseTreeNodeIndex(InStartNodePtr))
+		{
+			auto IsMatch = [InSCSNode](const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) { return InNodePtr->GetSCSNode() == InSCSNode; };
+
+			NodePtr = FindIndexedTreeNode(SCSNodeToNodeIndex, InSCSNode, InStartNodePtr, IsMatch);
+			if(!NodePtr.IsValid() && !bTreeNodeIndexComplete)
+			{
+				RebuildTreeNodeIndex(/*bIncludeNodeNames =*/false);
+				NodePtr = FindIndexedTreeNode(SCSNodeToNodeIndex, InSCSNode, InStartNodePtr, IsMatch);
+			}
+		}
+		else if(InStartNodePtr.IsValid())
 		{
 			// Check to see if the given SCS node matches the given tree node
 			if(InStartNodePtr->GetSCSNode() == InSCSNode)
@@ -6280,7 +8010,18 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::FindTreeNode(const UActorCom
 			InStartNodePtr = GetActorNode();
 		}
 
-		if(InStartNodePtr.IsValid())
+		if(InStartNodePtr.IsValid() && CanUseTreeNodeIndex(InStartNodePtr))
+		{
+			auto IsMatch = [InComponent](const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) { return InNodePtr->GetComponentTemplate() == InComponent; };
+
+			NodePtr = FindIndexedTreeNode(ComponentToNodeIndex, InComponent, InStartNodePtr, IsMatch);
+			if(!NodePtr.IsValid() && !bTreeNodeIndexComplete)
+			{
+				RebuildTreeNodeIndex(/*bIncludeNodeNames =*/false);
+				NodePtr = FindIndexedTreeNode(ComponentToNodeIndex, InComponent, InStartNodePtr, IsMatch);
+			}
+		}
+		else if(InStartNodePtr.IsValid())
 		{
 			// Check to see if the given component template matches the given tree node
 			// 
@@ -6324,7 +8065,20 @@ FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::FindTreeNode(const FName& In
 			InStartNodePtr = GetActorNode();
 		}
 
-		if(InStartNodePtr.IsValid())
+		if(InStartNodePtr.IsValid() && CanUseTreeNodeIndex(InStartNodePtr))
+		{
+			auto IsMatch = [&InVariableOrInstanceName](const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) { return InNodePtr->GetNodeID() == InVariableOrInstanceName; };
+
+			// Names are not indexed on insertion, so a miss refreshes the table unless it was built for the current tree; renames
+			// and changes to the root set clear bNameIndexComplete
+			NodePtr = FindIndexedTreeNode(NameToNodeIndex, InVariableOrInstanceName, InStartNodePtr, IsMatch);
+			if(!NodePtr.IsValid() && (!bNameIndexComplete || NameIndexStructureGeneration != GetTreeStructureGeneration()))
+			{
+				RebuildTreeNodeIndex(/*bIncludeNodeNames =*/true);
+				NodePtr = FindIndexedTreeNode(NameToNodeIndex, InVariableOrInstanceName, InStartNodePtr, IsMatch);
+			}
+		}
+		else if(InStartNodePtr.IsValid())
 		{
 			FName ItemName = InStartNodePtr->GetNodeID();
 
@@ -6415,26 +8169,126 @@ bool SSCSRuntimeEditor::CanRenameComponent() const
 	//return IsEditingAllowed() && SCSTreeWidget->GetSelectedItems().Num() == 1 && SCSTreeWidget->GetSelectedItems()[0]->CanRename();
 }
 
+uint32 SSCSRuntimeEditor::GetTreeStructureGeneration() const
+{
+	// Each root counts the changes below it and only ever counts up
+	uint32 StructureGeneration = 0;
+	for (const FSCSRuntimeEditorTreeNodePtrType& RootNode : RootNodes)
+	{
+		StructureGeneration += RootNode.IsValid() ? RootNode->GetStructureGeneration() : 0;
+	}
+
+	return StructureGeneration;
+}
+
 void SSCSRuntimeEditor::GetCollapsedNodes(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr, TSet<FSCSRuntimeEditorTreeNodePtrType>& OutCollapsedNodes) const
 {
-	if(InNodePtr.IsValid())
+	TArray<FSCSRuntimeEditorTreeNodePtrType, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add(InNodePtr);
+	while(NodeStack.Num() > 0)
 	{
-		const TArray<FSCSRuntimeEditorTreeNodePtrType>& Children = InNodePtr->GetChildren();
-		if(Children.Num() > 0)
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+		if(!NodePtr.IsValid())
 		{
-			if(!SCSTreeWidget->IsItemExpanded(InNodePtr))
-			{
-				OutCollapsedNodes.Add(InNodePtr);
-			}
+			continue;
+		}
 
-			for(int32 i = 0; i < Children.Num(); ++i)
-			{
-				GetCollapsedNodes(Children[i], OutCollapsedNodes);
-			}
+		// Only nodes with children are expandable
+		const TArray<FSCSRuntimeEditorTreeNodePtrType>& Children = NodePtr->GetChildren();
+		if((Children.Num() > 0 || HasDeferredChildren(NodePtr)) && !SCSTreeWidget->IsItemExpanded(NodePtr))
+		{
+			OutCollapsedNodes.Add(NodePtr);
+		}
+
+		NodeStack.Append(Children);
+	}
+}
+
+void SSCSRuntimeEditor::DeferTreeComponent(UActorComponent* InComponent, const UActorComponent* InTreeParentComponent)
+{
+	DeferredChildComponents.FindOrAdd(InTreeParentComponent).Add(InComponent);
+	DeferredTreeParents.Add(InComponent, InTreeParentComponent);
+}
+
+bool SSCSRuntimeEditor::HasDeferredChildren(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) const
+{
+	// A reconcile empties the lists in place while it runs, so an entry only counts if its list has something in it
+	const TArray<TWeakObjectPtr<UActorComponent>>* ChildComponents = DeferredChildComponents.Num() > 0 && InNodePtr.IsValid() ? DeferredChildComponents.Find(InNodePtr->GetComponentTemplate()) : nullptr;
+	return ChildComponents != nullptr && ChildComponents->Num() > 0;
+}
+
+void SSCSRuntimeEditor::MaterializeDeferredChildren(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr)
+{
+	TArray<TWeakObjectPtr<UActorComponent>> ChildComponents;
+	if (!HasDeferredChildren(InNodePtr) || !DeferredChildComponents.RemoveAndCopyValue(InNodePtr->GetComponentTemplate(), ChildComponents))
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<UActorComponent>& ChildComponentPtr : ChildComponents)
+	{
+		DeferredTreeParents.Remove(ChildComponentPtr);
+
+		UActorComponent* ChildComponent = ChildComponentPtr.Get();
+		if (ChildComponent != nullptr && !ChildComponent->IsPendingKill())
+		{
+			FSCSRuntimeEditorTreeNodePtrType ChildNodePtr = FSCSRuntimeEditorTreeNode::FactoryNodeFromComponent(ChildComponent);
+			InNodePtr->AddChild(ChildNodePtr);
+			RefreshFilteredState(ChildNodePtr, false);
+			IndexTreeNode(ChildNodePtr);
+
+			// Any children of its own stay deferred until it is expanded in turn
+			SCSTreeWidget->SetItemExpansion(ChildNodePtr, !DeferredChildComponents.Contains(ChildComponent));
+		}
+	}
+}
+
+void SSCSRuntimeEditor::MaterializeDeferredSubtree(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr)
+{
+	TArray<FSCSRuntimeEditorTreeNodePtrType, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add(InNodePtr);
+	while (NodeStack.Num() > 0 && DeferredChildComponents.Num() > 0)
+	{
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+		if (NodePtr.IsValid())
+		{
+			MaterializeDeferredChildren(NodePtr);
+			NodeStack.Append(NodePtr->GetChildren());
 		}
 	}
 }
 
+FSCSRuntimeEditorTreeNodePtrType SSCSRuntimeEditor::MaterializeDeferredComponent(const UActorComponent* InComponent)
+{
+	// Collect the deferred ancestors, up to the first one whose parent node has been built
+	TArray<const UActorComponent*, TInlineAllocator<16>> TreeParents;
+	for (const UActorComponent* Component = InComponent; DeferredTreeParents.Contains(Component); )
+	{
+		Component = DeferredTreeParents.FindRef(Component).Get();
+		if (Component == nullptr || TreeParents.Contains(Component))
+		{
+			return FSCSRuntimeEditorTreeNodePtrType();
+		}
+		TreeParents.Add(Component);
+	}
+
+	// Build one level at a time, from the top down
+	FSCSRuntimeEditorTreeNodePtrType NodePtr;
+	for (int32 ParentIndex = TreeParents.Num() - 1; ParentIndex >= 0; --ParentIndex)
+	{
+		FSCSRuntimeEditorTreeNodePtrType ParentNodePtr = FindTreeNode(TreeParents[ParentIndex]);
+		if (!ParentNodePtr.IsValid())
+		{
+			return FSCSRuntimeEditorTreeNodePtrType();
+		}
+
+		MaterializeDeferredChildren(ParentNodePtr);
+		SCSTreeWidget->SetItemExpansion(ParentNodePtr, true);
+	}
+
+	return FindTreeNode(InComponent);
+}
+
 EVisibility SSCSRuntimeEditor::GetPromoteToBlueprintButtonVisibility() const
 {
 	return EVisibility::Collapsed;
@@ -6799,16 +8653,34 @@ AActor* SSCSRuntimeEditor::GetActorContext() const
 
 void SSCSRuntimeEditor::SetItemExpansionRecursive(FSCSRuntimeEditorTreeNodePtrType Model, bool bInExpansionState)
 {
-	SetNodeExpansionState(Model, bInExpansionState);
-	for (const FSCSRuntimeEditorTreeNodePtrType& Child : Model->GetChildren())
+	if (bInExpansionState)
 	{
-		if (Child.IsValid())
+		MaterializeDeferredSubtree(Model);
+	}
+
+	TArray<FSCSRuntimeEditorTreeNodePtrType, TInlineAllocator<64>> NodeStack;
+	NodeStack.Add(Model);
+	while (NodeStack.Num() > 0)
+	{
+		FSCSRuntimeEditorTreeNodePtrType NodePtr = NodeStack.Pop(/*bAllowShrinking =*/false);
+		if (NodePtr.IsValid())
 		{
-			SetItemExpansionRecursive(Child, bInExpansionState);
+			SetNodeExpansionState(NodePtr, bInExpansionState);
+			NodeStack.Append(NodePtr->GetChildren());
 		}
 	}
 }
 
+void SSCSRuntimeEditor::OnItemExpansionChanged(FSCSRuntimeEditorTreeNodePtrType Model, bool bInExpansionState)
+{
+	// Only ever called outside of the tree's own linearization, so it is safe to link nodes and change expansion from here
+	if (bInExpansionState && HasDeferredChildren(Model))
+	{
+		MaterializeDeferredChildren(Model);
+		SCSTreeWidget->RequestTreeRefresh();
+	}
+}
+
 FText SSCSRuntimeEditor::GetFilterText() const
 {
 	return FilterBox->GetText();
@@ -6816,6 +8688,8 @@ FText SSCSRuntimeEditor::GetFilterText() const
 
 void SSCSRuntimeEditor::OnFilterTextChanged(const FText& InFilterText)
 {
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_OnFilterTextChanged);
+
 	struct OnFilterTextChanged_Inner
 	{
 		static FSCSRuntimeEditorTreeNodePtrType ExpandToFilteredChildren(SSCSRuntimeEditor* SCSRuntimeEditor, FSCSRuntimeEditorTreeNodePtrType TreeNode)
@@ -6843,7 +8717,45 @@ void SSCSRuntimeEditor::OnFilterTextChanged(const FText& InFilterText)
 	};
 
 	FSCSRuntimeEditorTreeNodePtrType NewSelection;
-	const bool bIsFilterBlank = GetFilterText().IsEmpty();
+	const bool bIsFilterBlank = InFilterText.IsEmpty();
+	bIsFilterActive = !bIsFilterBlank;
+
+	TArray<FString> NewFilterTerms;
+	FText::TrimPrecedingAndTrailing(InFilterText).ToString().ToLower().ParseIntoArray(NewFilterTerms, TEXT(" "), /*CullEmpty =*/true);
+
+	// The filter only got narrower if every previous term is contained in one of the new terms (e.g. while typing more characters)
+	bool bOnlyRetestMatches = FilterTerms.Num() > 0;
+	for (int32 TermIndex = 0; TermIndex < FilterTerms.Num() && bOnlyRetestMatches; ++TermIndex)
+	{
+		bOnlyRetestMatches = NewFilterTerms.ContainsByPredicate([&OldTerm = FilterTerms[TermIndex]](const FString& NewTerm)
+		{
+			return NewTerm.Contains(OldTerm, ESearchCase::CaseSensitive);
+		});
+	}
+	FilterTerms = MoveTemp(NewFilterTerms);
+
+	// Deferred components have no node to match yet, so match their names and build only the paths down to the ones that pass
+	if (!bIsFilterBlank && DeferredTreeParents.Num() > 0)
+	{
+		TArray<const UActorComponent*, TInlineAllocator<16>> DeferredMatches;
+		for (const TPair<TWeakObjectPtr<const UActorComponent>, TWeakObjectPtr<const UActorComponent>>& DeferredEntry : DeferredTreeParents)
+		{
+			const UActorComponent* DeferredComponent = DeferredEntry.Key.Get();
+			if (DeferredComponent != nullptr)
+			{
+				const FString DeferredKey = DeferredComponent->GetName().ToLower();
+				if (!FilterTerms.ContainsByPredicate([&DeferredKey](const FString& FilterTerm) { return !DeferredKey.Contains(FilterTerm, ESearchCase::CaseSensitive); }))
+				{
+					DeferredMatches.Add(DeferredComponent);
+				}
+			}
+		}
+
+		for (const UActorComponent* DeferredComponent : DeferredMatches)
+		{
+			MaterializeDeferredComponent(DeferredComponent);
+		}
+	}
 
 	bool bRootItemFilteredBackIn = false;
 	// iterate backwards so we select from the top down
@@ -6852,7 +8764,7 @@ void SSCSRuntimeEditor::OnFilterTextChanged(const FText& InFilterText)
 		FSCSRuntimeEditorTreeNodePtrType Node = RootNodes[ComponentIndex];
 
 		const bool bWasFilteredOut = Node->IsFlaggedForFiltration();
-		bool bFilteredOut = RefreshFilteredState(Node, true);
+		bool bFilteredOut = RefreshFilteredState(Node, true, bOnlyRetestMatches);
 
 		if (!bFilteredOut)
 		{
@@ -6872,32 +8784,35 @@ void SSCSRuntimeEditor::OnFilterTextChanged(const FText& InFilterText)
 	UpdateTree(/*bRegenerateTreeNodes =*/false);
 }
 
-bool SSCSRuntimeEditor::RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType TreeNode, bool bRecursive)
+bool SSCSRuntimeEditor::RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType TreeNode, bool bRecursive, bool bOnlyRetestMatches) const
 {
-	FString FilterText = FText::TrimPrecedingAndTrailing( GetFilterText() ).ToString();
-	TArray<FString> FilterTerms;
-	FilterText.ParseIntoArray(FilterTerms, TEXT(" "), /*CullEmpty =*/true);
+	ACTORRUNTIMEDETAILS_SCOPE_CYCLE_COUNTER(STAT_SCSRuntimeEditor_RefreshFilteredState);
 
 	struct RefreshFilteredState_Inner
 	{
-		static void RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType TreeNodeIn, const TArray<FString>& FilterTermsIn, bool bRecursiveIn)
+		static void RefreshFilteredState(const FSCSRuntimeEditorTreeNodePtrType& TreeNodeIn, const TArray<FString>& FilterTermsIn, bool bRecursiveIn, bool bOnlyRetestMatchesIn)
 		{
 			if (bRecursiveIn)
 			{
-				for (FSCSRuntimeEditorTreeNodePtrType Child : TreeNodeIn->GetChildren())
+				for (const FSCSRuntimeEditorTreeNodePtrType& Child : TreeNodeIn->GetChildren())
 				{
-					RefreshFilteredState(Child, FilterTermsIn, bRecursiveIn);
+					RefreshFilteredState(Child, FilterTermsIn, bRecursiveIn, bOnlyRetestMatchesIn);
 				}
 			}
-			
-			FString DisplayStr = TreeNodeIn->GetDisplayString();
 
-			bool bIsFilteredOut = false;
-			for (const FString& FilterTerm : FilterTermsIn)
+			// A narrower filter can't bring back a node that didn't match, but its child match state still needs a refresh below
+			bool bIsFilteredOut = bOnlyRetestMatchesIn && TreeNodeIn->HasFilterState() && !TreeNodeIn->DidMatchFilter();
+			if (!bIsFilteredOut && FilterTermsIn.Num() > 0)
 			{
-				if (!DisplayStr.Contains(FilterTerm))
+				// Both the key and the terms are lowercase, so a case-sensitive search gives a case-insensitive match
+				const FString& FilterKey = TreeNodeIn->GetFilterKey();
+				for (const FString& FilterTerm : FilterTermsIn)
 				{
-					bIsFilteredOut = true;
+					if (!FilterKey.Contains(FilterTerm, ESearchCase::CaseSensitive))
+					{
+						bIsFilteredOut = true;
+						break;
+					}
 				}
 			}
 			// if we're not recursing, then assume this is for a new node and we need to update the parent
@@ -6906,7 +8821,8 @@ bool SSCSRuntimeEditor::RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType Tr
 		}
 	};
 
-	RefreshFilteredState_Inner::RefreshFilteredState(TreeNode, FilterTerms, bRecursive);
+	RefreshFilteredState_Inner::RefreshFilteredState(TreeNode, FilterTerms, bRecursive, bOnlyRetestMatches);
+
 	return TreeNode->IsFlaggedForFiltration();
 }
 
@@ -26,18 +26,57 @@
 #include "ScopedTransaction.h"
 
 class FMenuBuilder;
+class IComponentAssetBroker;
 #if UE_4_24_OR_LATER
 class UToolMenu;
 #endif
 class FSCSRuntimeEditorTreeNode;
 class SSCSRuntimeEditor;
+class UChildActorComponent;
 class UPrimitiveComponent;
+struct FSCSRuntimeEditorTreeModel;
 struct EventData;
 
 // SCS tree node pointer type
 using FSCSRuntimeEditorTreeNodePtrType = TSharedPtr<class FSCSRuntimeEditorTreeNode>;
 using FSCSRuntimeEditorActorNodePtrType = TSharedPtr<class FSCSRuntimeEditorTreeNodeRootActor>;
 
+/**
+ * The values shown by the row of a tree node, which are costly to look up (asset brokerage, Blueprint hierarchy walks, class
+ * display names). They are computed together the first time the row is painted and kept until the node's component may have
+ * changed, so that the row's attributes only read plain values.
+ */
+struct FSCSRuntimeEditorRowViewModel
+{
+	FText DisplayString;
+	FText ToolTipTitle;
+	FText AssetName;
+	FText AssetPath;
+	bool bSupportsAssets;
+	const FSlateBrush* MobilityIcon;
+	FText MobilityToolTip;
+	FText ComponentAddSourceToolTip;
+	FText IntroducedInToolTip;
+
+	// What the values above were looked up from, compared by SSCS_RuntimeRowWidget::IsRowViewModelCurrent(); never dereferenced
+	FName ComponentName;
+	const UObject* Asset;
+	TEnumAsByte<EComponentMobility::Type> Mobility;
+
+	// The asset broker of the component's class, if it has one, so that the asset can be compared without looking it up again
+	TSharedPtr<IComponentAssetBroker> AssetBroker;
+};
+
+/** How a component differs from the baseline captured for its Actor by SSCSRuntimeEditor::CaptureBaseline() */
+enum class ESCSRuntimeBaselineChange : uint8
+{
+	None,
+	// The component wasn't there when the baseline was captured
+	Added,
+	// The component is attached to a different parent than when the baseline was captured
+	Reattached,
+};
+
 /**
  * FSCSRuntimeEditorTreeNode
  *
@@ -199,6 +238,14 @@ public:
 	 */
 	virtual void RemoveChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr);
 
+	/**
+	 * Unlinks the given node from the list of child nodes without modifying the underlying SCS node or component attachment.
+	 * Used when reconciling the tree against the current state of an Actor instance.
+	 *
+	 * @param InChildNodePtr The child node to unlink.
+	 */
+	virtual void UnlinkChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr);
+
 	bool IsSceneComponent() const
 	{
 		return Cast<USceneComponent>(GetComponentTemplate()) != nullptr;
@@ -214,6 +261,18 @@ public:
 
 	// Destructor
 	virtual ~FSCSRuntimeEditorTreeNode() {}
+
+	/** Nodes of every type are allocated from a shared pool, so that regenerating the tree recycles the memory of the previous one */
+	static void* operator new(size_t Size);
+	static void operator delete(void* Ptr, size_t Size);
+
+	/**
+	 * @return The number of nodes created since the module was loaded, and how many of those the pool had no free block for and
+	 * had to allocate memory; the same counts as the Tree Nodes Created and Tree Node Pool Misses stats, without stats enabled
+	 */
+	static uint64 GetNumNodesCreated();
+	static uint64 GetNumNodePoolMisses();
+
 protected:
 	// Called when this node is being removed via a RemoveChild call
 	virtual void RemoveMeAsChild() {}
@@ -308,11 +367,40 @@ public:
 	/** Refreshes this item's filtration state. Use bUpdateParent to make sure the parent's EFilteredState::ChildMatches flag is properly updated based off the new state */
 	void UpdateCachedFilterState(bool bMatchesFilter, bool bUpdateParent);
 
+	/** @return A counter bumped on the root node of a tree whenever a node is linked into or out of it; used to tell whether lookup tables built for the tree are still complete */
+	uint32 GetStructureGeneration() const { return StructureGeneration; }
+
+	/** @return The lowercased display string that filter terms are matched against; cached until InvalidateFilterKey() is called */
+	const FString& GetFilterKey() const;
+
+	/** Discards the cached filter key of this node, e.g. when its component may have been renamed */
+	void InvalidateFilterKey() { bFilterKeyValid = false; }
+
+	/** @return The values shown by this node's row; computed on first use and cached until the row view model is invalidated */
+	const FSCSRuntimeEditorRowViewModel& GetRowViewModel() const;
+
+	/** Discards the cached row view model of this node, e.g. when a property of its component changed */
+	void InvalidateRowViewModel() { bRowViewModelValid = false; }
+
+	/**
+	 * Discards the cached row view model of this node if the component's name, asset or mobility changed since it was built;
+	 * cheap enough to be called on every node while gameplay code may be changing the components.
+	 */
+	void RevalidateRowViewModel();
+
+	/** @return True if this node itself (rather than one of its children) matched the filter the last time its state was refreshed */
+	bool DidMatchFilter() const { return FilterFlags != EFilteredState::Unknown && (FilterFlags & EFilteredState::MatchesFilter) != 0; }
+
+	/** @return True if this node's filter state has been refreshed at least once */
+	bool HasFilterState() const { return FilterFlags != EFilteredState::Unknown; }
+
 protected:
 	/** Updates the EFilteredState::ChildMatches flag, based off of children's current state */
 	void RefreshCachedChildFilterState(bool bUpdateParent);
 	/** Used to update the EFilteredState::ChildMatches flag for parent nodes, when this item's filtration state has changed */
 	void ApplyFilteredStateToParent();
+	/** Bumps the structure generation of the root node of the tree this node is part of */
+	void MarkStructureChanged();
 	
 	// Scope the creation of a component which ends when the initial component 'name' is given/accepted by the user, which can be several frames after the component was actually created.
 	TUniquePtr<FScopedTransaction> OngoingCreateTransaction;
@@ -341,6 +429,17 @@ private:
 		Unknown = 0xFC // ~FilteredInMask
 	};
 	uint8 FilterFlags;
+
+	// Bumped on every structural change below this node while it is the root of a tree
+	uint32 StructureGeneration;
+
+	// Lowercased display string, valid while bFilterKeyValid is set
+	mutable FString FilterKey;
+	mutable bool bFilterKeyValid;
+
+	// Values shown by the row, allocated the first time the node is shown and valid while bRowViewModelValid is set
+	mutable TUniquePtr<FSCSRuntimeEditorRowViewModel> RowViewModel;
+	mutable bool bRowViewModelValid;
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -505,18 +604,24 @@ public:
 	/** Returns the set of root nodes */
 	const TArray<FSCSRuntimeEditorTreeNodePtrType>& GetComponentNodes() const;
 
+	/** Returns the Actor represented by this node */
+	AActor* GetActor() const { return Actor; }
+
 	// FSCSRuntimeEditorTreeNode public interface
 	virtual FName GetNodeID() const override;
 	virtual bool CanRename() const override { return bAllowRename; }
 	virtual void OnCompleteRename(const FText& InNewName) override;
 	virtual void AddChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr) override;
 	virtual void RemoveChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr) override;
+	virtual void UnlinkChild(FSCSRuntimeEditorTreeNodePtrType InChildNodePtr) override;
 	// End of FSCSRuntimeEditorTreeNode public interface
 protected:
 	using Super = FSCSRuntimeEditorTreeNode;
 
 private:
-	
+	/** Removes the separator nodes once no component nodes of the matching kind remain */
+	void RemoveUnusedSeparators();
+
 	AActor* Actor;
 	bool bAllowRename;
 
@@ -558,6 +663,10 @@ public:
 	virtual FReply OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 	// End of SWidget interface
 
+	// ITableRow interface
+	virtual int32 DoesItemHaveChildren() const override;
+	// End of ITableRow interface
+
 	/** Get the blueprint we are editing */
 	UBlueprint* GetBlueprint() const;
 
@@ -577,11 +686,23 @@ public:
 	/* Get the node used by the row Widget */
 	virtual FSCSRuntimeEditorTreeNodePtrType GetNode() const { return TreeNodePtr; };
 
+	/** Computes the values shown by the row of the given node */
+	static void BuildRowViewModel(const FSCSRuntimeEditorTreeNode& InNode, FSCSRuntimeEditorRowViewModel& OutViewModel);
+
+	/** @return False if the component's name, asset or mobility no longer match what the given view model was built from */
+	static bool IsRowViewModelCurrent(const FSCSRuntimeEditorTreeNode& InNode, const FSCSRuntimeEditorRowViewModel& InViewModel);
+
+	/** Shows the difference from the baseline found by the owning editor's last comparison; called by the editor after each one */
+	void UpdateBaselineBadge();
+
 protected:
 	virtual ESelectionMode::Type GetSelectionMode() const override;
 
 	static void AddToToolTipInfoBox(const TSharedRef<SVerticalBox>& InfoBox, const FText& Key, TSharedRef<SWidget> ValueIcon, const TAttribute<FText>& Value, bool bImportant);
 
+	/** Creates the badge that shows how the row's component differs from the baseline, if baseline mode is enabled */
+	TSharedRef<SWidget> MakeBaselineBadgeWidget();
+
 	/** Commits the new name of the component */
 	void OnNameTextCommit(const FText& InNewName, ETextCommit::Type InTextCommit);
 
@@ -650,6 +771,13 @@ private:
 	 */
 	FText GetComponentAddSourceToolTipText() const;
 
+	/** Lookups behind the cached values of BuildRowViewModel() */
+	static FText ComputeToolTipTitle(const FSCSRuntimeEditorTreeNode& InNode);
+	static FSlateBrush const* ComputeMobilityIconImage(const FSCSRuntimeEditorTreeNode& InNode);
+	static FText ComputeMobilityToolTipText(const FSCSRuntimeEditorTreeNode& InNode);
+	static FText ComputeIntroducedInToolTipText(const FSCSRuntimeEditorTreeNode& InNode);
+	static FText ComputeComponentAddSourceToolTipText(const FSCSRuntimeEditorTreeNode& InNode);
+
 public:
 	/** Pointer back to owning SCSRuntimeEditor 2 tool */
 	TWeakPtr<SSCSRuntimeEditor> SCSRuntimeEditor;
@@ -657,6 +785,9 @@ public:
 private:
 	/** Pointer to node we represent */
 	FSCSRuntimeEditorTreeNodePtrType TreeNodePtr;
+
+	/** The badge made by MakeBaselineBadgeWidget(), if the row has one */
+	TSharedPtr<STextBlock> BaselineBadge;
 };
 
 class SSCS_RuntimeRowWidget_ActorRoot : public SSCS_RuntimeRowWidget
@@ -782,6 +913,9 @@ namespace EComponentEditorMode
 
 class SSCSRuntimeEditor : public SCompoundWidget
 {
+	// Drives the tree operations directly to time them
+	friend class FSCSRuntimeEditorBenchmark;
+
 public:
 	DECLARE_DELEGATE_RetVal_OneParam(class USCS_Node*, FOnAddNewComponent, class UClass*);
 	DECLARE_DELEGATE_RetVal_OneParam(class USCS_Node*, FOnAddExistingComponent, class UActorComponent*);
@@ -859,7 +993,10 @@ public:
 		@return The reference of the newly created ActorComponent */
 	UActorComponent* AddNewNodeForInstancedComponent(TUniquePtr<FScopedTransaction> OngoingCreateTransaction, UActorComponent* NewInstanceComponent, FSCSRuntimeEditorTreeNodePtrType InParentNodePtr, UObject* Asset, bool bSetFocusToNewItem = true);
 	
-	/** Returns true if the specified component is currently selected */
+	/**
+	 * Returns true if the specified component is currently selected. This is installed as the primitive's selection override,
+	 * so it is answered from a set of selected components that is rebuilt at most once per selection change.
+	 */
 	bool IsComponentSelected(const UPrimitiveComponent* PrimComponent) const;
 
 	/** Assigns a selection override delegate to the specified component */
@@ -903,7 +1040,10 @@ public:
 	/** Update any associated selection (e.g. details view) from the passed in nodes */
 	void UpdateSelectionFromNodes(const TArray<FSCSRuntimeEditorTreeNodePtrType> &SelectedNodes );
 
-	/** Refresh the tree control to reflect changes in the SCS */
+	/**
+	 * Refresh the tree control to reflect changes in the SCS. In Actor instance mode, regenerating the tree
+	 * reconciles the existing nodes against the instance when possible, rather than rebuilding them from scratch.
+	 */
 	void UpdateTree(bool bRegenerateTreeNodes = true);
 
 	/** Dumps out the tree view contents to the log (used to assist with debugging widget hierarchy issues) */
@@ -937,6 +1077,12 @@ public:
 	 */
 	FSCSRuntimeEditorTreeNodePtrType GetNodeFromActorComponent(const UActorComponent* ActorComponent, bool bIncludeAttachedComponents = true) const;
 
+	/**
+	 * Like GetNodeFromActorComponent(), but first builds and expands the nodes down to the component if they were deferred. The
+	 * lookups never build nodes, so use this where the node is about to be selected or shown rather than only tested.
+	 */
+	FSCSRuntimeEditorTreeNodePtrType MaterializeNodeFromActorComponent(const UActorComponent* ActorComponent, bool bIncludeAttachedComponents = true);
+
 	/** Select the root of the tree */
 	void SelectRoot();
 
@@ -1002,12 +1148,61 @@ public:
 	/** Handler for recursively expanding/collapsing items */
 	void SetItemExpansionRecursive(FSCSRuntimeEditorTreeNodePtrType Model, bool bInExpansionState);
 
+	/** Handler for an item being expanded or collapsed; builds the deferred children of the item the first time it is expanded */
+	void OnItemExpansionChanged(FSCSRuntimeEditorTreeNodePtrType Model, bool bInExpansionState);
+
+	/** @return True if some children of the given node haven't been built yet */
+	bool HasDeferredChildren(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) const;
+
 	/** Callback for the action trees to get the filter text */
 	FText GetFilterText() const;
 
 	/** Called at the end of each frame. */
 	void OnPostTick(float);
 
+	/**
+	 * Sets the other selected Actors whose components are merged with the Actor context's in ActorInstance mode. Only the
+	 * components that have a match on every merged Actor (same name and class, or else the only component of that class)
+	 * are shown in the tree. Takes effect on the next UpdateTree().
+	 *
+	 * @param InActors	The Actors to merge, not including the Actor context; empty for single Actor mode
+	 * @return True if the merged Actors changed
+	 */
+	bool SetMergedActors(const TArray<AActor*>& InActors);
+
+	/** @return The Actors merged with the Actor context */
+	const TArray<TWeakObjectPtr<AActor>>& GetMergedActors() const { return MergedActors; }
+
+	/** @return The number of Actors merged with the Actor context that still exist */
+	int32 GetNumMergedActors() const;
+
+	/**
+	 * Appends the objects that are merged with the given ones: the matching components of the merged Actors for each
+	 * component shown in the tree, and the merged Actors themselves for the Actor context.
+	 */
+	void AppendMergedObjects(TArray<UObject*>& InOutObjects) const;
+
+	/**
+	 * Enables or disables baseline mode. While enabled, the component trees of the Actors in play are recorded as baselines when
+	 * play starts, and an Actor that has none yet is recorded the first time it is shown. Every tree update compares the Actor
+	 * against its baseline so that rows can show what changed since. Baselines are kept while the mode is disabled.
+	 */
+	void SetBaselineModeEnabled(bool bInEnabled);
+
+	/** @return True if baseline mode is enabled */
+	bool IsBaselineModeEnabled() const { return bBaselineModeEnabled; }
+
+	/** Records the current component tree of the Actor context as its baseline, replacing any previous one, and compares against it */
+	void CaptureBaseline();
+
+	/**
+	 * Returns how the component of the given node differs from the baseline, and how many components of the baseline that were
+	 * attached to it have been destroyed since. For the Actor node, the destroyed components are those whose parent is gone too.
+	 *
+	 * @return True if there is anything to report for the node
+	 */
+	bool GetBaselineDiff(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr, ESCSRuntimeBaselineChange& OutChange, int32& OutNumDestroyedChildren) const;
+
 protected:
 	FSCSRuntimeEditorTreeNodePtrType FindOrCreateParentForExistingComponent(UActorComponent* InActorComponent, FSCSRuntimeEditorActorNodePtrType ActorRootNode);
 	FSCSRuntimeEditorTreeNodePtrType FindParentForNewComponent(UActorComponent* NewComponent) const;
@@ -1053,6 +1248,9 @@ protected:
 	/** Called when component objects are replaced following construction script execution */
 	void OnObjectsReplaced(const TMap<UObject*, UObject*>& OldToNewInstanceMap);
 
+	/** Discards the row view model of the node of a component whose property was changed */
+	void OnObjectPropertyChanged(UObject* InObject, FPropertyChangedEvent& InPropertyChangedEvent);
+
 	/** Update component pointers held by tree nodes if components have been replaced following construction script execution */
 	void ReplaceComponentReferencesInTree(const TArray<FSCSRuntimeEditorTreeNodePtrType>& Nodes, const TMap<UObject*, UObject*>& OldToNewInstanceMap);
 
@@ -1096,12 +1294,119 @@ protected:
 	/** Helper method to recursively find a tree node for the given variable or instance name starting at the given tree node */
 	FSCSRuntimeEditorTreeNodePtrType FindTreeNode(const FName& InVariableOrInstanceName, FSCSRuntimeEditorTreeNodePtrType InStartNodePtr = FSCSRuntimeEditorTreeNodePtrType()) const;
 
+	/** Returns true if lookups starting at the given tree node can be resolved through the node lookup tables */
+	bool CanUseTreeNodeIndex(const FSCSRuntimeEditorTreeNodePtrType& InStartNodePtr) const;
+
+	/** Adds the given tree node to the component and SCS node lookup tables */
+	void IndexTreeNode(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr) const;
+
+	/** Removes the given tree node and its children from the node lookup tables */
+	void UnindexTreeNode(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr);
+
+	/**
+	 * Discards the node lookup tables and rebuilds them with a single walk of the current tree.
+	 *
+	 * @param bIncludeNodeNames Whether or not to also rebuild the variable or instance name lookup table (names are not indexed on insertion as they are costly to resolve).
+	 */
+	void RebuildTreeNodeIndex(bool bIncludeNodeNames) const;
+
 	/** Callback when a component item is scrolled into view */
 	void OnItemScrolledIntoView( FSCSRuntimeEditorTreeNodePtrType InItem, const TSharedPtr<ITableRow>& InWidget);
 
 	/** Callback when a component item is double clicked. */
 	void HandleItemDoubleClicked(FSCSRuntimeEditorTreeNodePtrType InItem);
 
+	/**
+	 * Returns the set of components owned by the given Actor instance that should be represented in the tree. With merged
+	 * Actors, this is narrowed down to the components they all share, and their matching instances are recorded.
+	 */
+	void GetInstancedComponentsForTree(AActor* InActorInstance, TSet<UActorComponent*>& OutComponents);
+
+	/**
+	 * Returns the component hierarchy to show for the given Actor instance. Without merged Actors, the model is shared with every
+	 * other component tree showing the same Actor, and is only rebuilt once the components of the Actor or their attachment change.
+	 */
+	TSharedRef<const FSCSRuntimeEditorTreeModel> GetTreeModel(AActor* InActorInstance);
+
+	/** Removes the components that don't have a match on every merged Actor, and records the matching instances for the others */
+	void MergeInstancedComponents(AActor* InActorInstance, TSet<UActorComponent*>& InOutComponents);
+
+	/**
+	 * Diffs the component set and attachment graph of the Actor instance against the existing tree, and only adds, removes or
+	 * reparents the nodes that changed. Node identity is kept, so expansion and selection state survive without any lookups.
+	 *
+	 * @return false if the existing tree cannot be reconciled (e.g. the Actor or its root component changed) and must be regenerated.
+	 */
+	bool ReconcileInstancedTreeNodes();
+
+	/** Compares the Actor context against its baseline and updates the badges of the generated rows */
+	void UpdateBaselineDiff();
+
+	/** Calls the given function on every row the tree has generated and still holds on to, dropping the others from GeneratedRows */
+	void ForEachGeneratedRow(TFunctionRef<void(SSCS_RuntimeRowWidget&)> InFunction);
+
+	/** Active timer that rebuilds the values of the generated rows whose component's name, asset or mobility changed since */
+	EActiveTimerReturnType RevalidateGeneratedRows(double InCurrentTime, float InDeltaTime);
+
+	/** Fills BaselineDiffs for the Actor context, capturing its baseline instead if it doesn't have one yet */
+	void CompareAgainstBaseline();
+
+	/** Records the component tree of the given Actor as its baseline, replacing any previous one */
+	void CaptureActorBaseline(AActor* InActor);
+
+	/** Records the baselines of every Actor in play, if baseline mode is enabled */
+	void OnPIEStarted(bool bIsSimulating);
+
+	ECheckBoxState GetBaselineModeCheckState() const;
+	void OnBaselineModeCheckStateChanged(ECheckBoxState InState);
+	EVisibility GetRecaptureBaselineVisibility() const;
+	FReply OnRecaptureBaselineClicked();
+
+	/** Returns the components represented by the selected tree nodes, rebuilding the cached set if the selection changed since it was last built */
+	const TSet<const UActorComponent*>& GetSelectedComponentCache() const;
+
+	/** What the baseline records of a component: enough to tell it apart, without keeping the component or a copy of it */
+	struct FBaselineComponentSignature
+	{
+		FName Name;
+		const UClass* Class;
+		FName AttachParentName;
+		EComponentCreationMethod CreationMethod;
+	};
+
+	/** How a component of the Actor context differs from its baseline */
+	struct FBaselineComponentDiff
+	{
+		ESCSRuntimeBaselineChange Change = ESCSRuntimeBaselineChange::None;
+		int32 NumDestroyedChildren = 0;
+	};
+
+	static FBaselineComponentSignature MakeBaselineSignature(const UActorComponent* InComponent);
+
+	/** @return The sum of the structure generations of the root nodes; while the root set is the same, it only changes if the tree did */
+	uint32 GetTreeStructureGeneration() const;
+
+	/** Records that the node for the given component isn't built until the node of its tree parent is expanded */
+	void DeferTreeComponent(UActorComponent* InComponent, const UActorComponent* InTreeParentComponent);
+
+	/**
+	 * Defers the components of the child actor spawned by the given component of the Actor context, and of the child actors nested
+	 * in it, below the node of the component that spawned each of them; their primitives are mapped to the given component
+	 */
+	void DeferChildActorTree(UChildActorComponent* InChildActorComponent);
+
+	/** Builds the deferred child nodes of the given node, one level deep; any children they have stay deferred */
+	void MaterializeDeferredChildren(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr);
+
+	/** Builds every deferred node below the given node */
+	void MaterializeDeferredSubtree(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr);
+
+	/**
+	 * Builds and expands the nodes down to the given component if it is deferred, so that its node can be shown, and returns that
+	 * node. Lookups such as FindTreeNode() never build nodes, so this is called first wherever a deferred component needs one.
+	 */
+	FSCSRuntimeEditorTreeNodePtrType MaterializeDeferredComponent(const UActorComponent* InComponent);
+
 	/** Returns the set of expandable nodes that are currently collapsed in the UI */
 	void GetCollapsedNodes(const FSCSRuntimeEditorTreeNodePtrType& InNodePtr, TSet<FSCSRuntimeEditorTreeNodePtrType>& OutCollapsedNodes) const;
 
@@ -1157,9 +1462,11 @@ protected:
 	/** 
 	 * Compares the filter bar's text with the item's component name. Use 
 	 * bRecursive to refresh the state of child nodes as well. Returns true if 
-	 * the node is set to be filtered out 
+	 * the node is set to be filtered out. Set bOnlyRetestMatches when the filter
+	 * has only become narrower, so that nodes which didn't match before are kept out
+	 * without testing them again.
 	 */
-	bool RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType TreeNode, bool bRecursive);
+	bool RefreshFilteredState(FSCSRuntimeEditorTreeNodePtrType TreeNode, bool bRecursive, bool bOnlyRetestMatches = false) const;
 
 public:
 	/** Tree widget */
@@ -1219,6 +1526,87 @@ private:
 	/** TRUE if this SCSRuntimeEditor is currently the target of a diff */
 	bool bIsDiffing;
 
+	/** Lookup tables from a component, SCS node or variable/instance name to the tree node that represents it. Entries are validated on lookup. */
+	mutable TMap<const UActorComponent*, TWeakPtr<FSCSRuntimeEditorTreeNode>> ComponentToNodeIndex;
+	mutable TMap<const USCS_Node*, TWeakPtr<FSCSRuntimeEditorTreeNode>> SCSNodeToNodeIndex;
+	mutable TMap<FName, TWeakPtr<FSCSRuntimeEditorTreeNode>> NameToNodeIndex;
+
+	/** TRUE if the component and SCS node lookup tables cover every node in the tree, so that a miss doesn't need to fall back to a tree walk */
+	mutable bool bTreeNodeIndexComplete;
+
+	/** TRUE if the name lookup table covered every node of the tree as of NameIndexStructureGeneration, so that a miss is final until the tree changes */
+	mutable bool bNameIndexComplete;
+	mutable uint32 NameIndexStructureGeneration;
+
+	/** Incremented whenever the tree selection, or the components represented by the tree nodes, may have changed */
+	uint32 SelectionGeneration;
+
+	/** Components represented by the selected tree nodes as of CachedSelectionGeneration */
+	mutable TSet<const UActorComponent*> SelectedComponentCache;
+	mutable uint32 CachedSelectionGeneration;
+
+	/** TRUE if the filter box has any text, cached so that generating children for the tree doesn't need to query it */
+	bool bIsFilterActive;
+
+	/** Lowercased terms of the current filter text, parsed once per change of the filter box */
+	TArray<FString> FilterTerms;
+
+	/**
+	 * Components whose node hasn't been built yet, keyed by the component of their parent node, and the reverse mapping. In Actor
+	 * instance mode, only the top of a large tree is built up front; the rest is built as it is expanded.
+	 */
+	TMap<TWeakObjectPtr<const UActorComponent>, TArray<TWeakObjectPtr<UActorComponent>>> DeferredChildComponents;
+	TMap<TWeakObjectPtr<const UActorComponent>, TWeakObjectPtr<const UActorComponent>> DeferredTreeParents;
+
+	/** The child actor component of the Actor context through which each primitive of a (possibly nested) child actor is selected */
+	TMap<const UPrimitiveComponent*, const UChildActorComponent*> ChildActorPrimitiveOwners;
+
+	/** Scratch containers for regenerating the tree, kept between rebuilds so that their memory is reused */
+	TSet<FSCSRuntimeEditorTreeNodePtrType> TreeBuildCollapsedNodes;
+	TSet<const UActorComponent*> TreeBuildCollapsedComponents;
+	TArray<FSCSRuntimeEditorTreeNodePtrType> TreeBuildNodes;
+	TArray<const UActorComponent*> TreeBuildExpandedChildActorComponents;
+
+	/** The tree model this tree built last, rebuilt in place once no other tree holds on to it, and the one for child actors */
+	TSharedPtr<FSCSRuntimeEditorTreeModel> LastTreeModel;
+	TSharedPtr<FSCSRuntimeEditorTreeModel> ChildActorTreeModel;
+
+	/** True if LastTreeModel was returned during the current UpdateTree(), so that it doesn't need to be checked again */
+	bool bLastTreeModelCurrent;
+
+	/** Scratch containers for reconciling the tree, kept between updates so that their memory is reused */
+	TArray<FSCSRuntimeEditorTreeNodePtrType> ReconcileExistingNodes;
+	TMap<const UActorComponent*, FSCSRuntimeEditorTreeNodePtrType> ReconcileExistingNodeMap;
+	TMap<const UActorComponent*, FSCSRuntimeEditorTreeNodePtrType> ReconcileReconciledNodeMap;
+	TArray<FSCSRuntimeEditorTreeNodePtrType> ReconcileChildActorNodes;
+	TArray<FSCSRuntimeEditorTreeNodePtrType> ReconcileNodeStack;
+	TArray<UActorComponent*> ReconcileComponentStack;
+
 	/** The filter box that handles filtering for the tree. */
 	TSharedPtr< SSearchBox > FilterBox;
+
+	/** Other Actors whose components are merged with the Actor context's */
+	TArray<TWeakObjectPtr<AActor>> MergedActors;
+
+	/** The matching components of the merged Actors, keyed by the Actor context's component that represents them in the tree */
+	TMap<const UActorComponent*, TArray<TWeakObjectPtr<UActorComponent>>> MergedComponentInstances;
+
+	/** TRUE if the Actor context is compared against a baseline on every tree update */
+	bool bBaselineModeEnabled;
+
+	/** The component tree recorded for each Actor shown while baseline mode was enabled */
+	TMap<TWeakObjectPtr<AActor>, TArray<FBaselineComponentSignature>> Baselines;
+
+	/** The differences from the baseline found by the last tree update, and the destroyed components shown on the Actor node */
+	TMap<const UActorComponent*, FBaselineComponentDiff> BaselineDiffs;
+	int32 NumDestroyedUnderActorNode;
+
+	/** Scratch containers for comparing against the baseline, kept between updates so that their memory is reused */
+	TMap<FName, int32> BaselineDiffIndices;
+	TMap<FName, const UActorComponent*> BaselineDiffComponents;
+	TBitArray<> BaselineDiffMatched;
+
+	/** The rows generated by the tree, which it releases as they scroll out of view; pruned once it reaches GeneratedRowsPruneThreshold */
+	TArray<TWeakPtr<SSCS_RuntimeRowWidget>> GeneratedRows;
+	int32 GeneratedRowsPruneThreshold;
 };
@@ -26,8 +26,11 @@ private:
 	void AddToolbarExtension(FToolBarBuilder& Builder);
 	void AddMenuExtension(FMenuBuilder& Builder);
 
+	/** Registers the style and commands and loads the modules the panels depend on, the first time a Runtime Details tab is opened */
+	void InitializeOnFirstUse();
+
 	TSharedRef<class SWidget> CreateActorRuntimeDetails(const FName TabIdentifier);
-	TSharedRef<class SDockTab> SpawnActorRuntimeDetailsTab(const FSpawnTabArgs& Args);
+	TSharedRef<class SDockTab> SpawnActorRuntimeDetailsTab(const FSpawnTabArgs& Args, FName TabIdentifier, FText Label);
 
 	/** Called when actors are selected or unselected */
 	void OnActorSelectionChanged(const TArray<UObject*>& NewSelection, bool bForceRefresh = false);
@@ -36,6 +39,9 @@ private:
 	FDelegateHandle LevelEditorTabManagerChangedHandle;
 	
 	TSharedPtr<class FUICommandList> PluginCommands;
+
+	/** True once InitializeOnFirstUse() has run */
+	bool bInitializedOnFirstUse;
 	
 	/** List of all actor details panels to update when selection changes */
 	TArray< TWeakPtr<class SActorRuntimeDetails> > AllActorDetailPanels;